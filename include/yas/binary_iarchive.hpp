@@ -53,6 +53,15 @@
 #include <yas/types/utility/object.hpp>
 #include <yas/types/utility/asis.hpp>
 #include <yas/types/utility/init.hpp>
+#include <yas/types/utility/delta.hpp>
+#include <yas/types/utility/timeseries.hpp>
+#include <yas/types/utility/columnar.hpp>
+#include <yas/types/utility/presence.hpp>
+#include <yas/types/utility/narrow.hpp>
+#include <yas/types/utility/quantize.hpp>
+#include <yas/types/utility/rle.hpp>
+#include <yas/types/utility/sparse.hpp>
+#include <yas/types/utility/string_table.hpp>
 
 #include <yas/buffers.hpp>
 #include <yas/object.hpp>
@@ -96,7 +105,16 @@ struct binary_iarchive
 
     template<typename Head, typename... Tail>
     this_type& serialize(Head &&head, Tail&&... tail) {
-        return operator& (std::forward<Head>(head)).serialize(std::forward<Tail>(tail)...);
+        using run = detail::fused_run<
+             F
+            ,typename std::decay<Head>::type
+            ,typename std::decay<Tail>::type...
+        >;
+        return serialize_run(
+             std::integral_constant<bool, (run::length > 1)>{}
+            ,std::forward<Head>(head)
+            ,std::forward<Tail>(tail)...
+        );
     }
 
     template<typename... Args>
@@ -108,6 +126,34 @@ struct binary_iarchive
     this_type& load(Args &&... args) {
         return serialize(std::forward<Args>(args)...);
     }
+
+private:
+    template<typename Head, typename... Tail>
+    this_type& serialize_run(std::false_type, Head &&head, Tail&&... tail) {
+        return operator& (std::forward<Head>(head)).serialize(std::forward<Tail>(tail)...);
+    }
+
+    // the leading run of the fixed-size fundamentals is read by one call
+    // and loaded from the buffer
+    template<typename... Args>
+    this_type& serialize_run(std::true_type, Args &&... args) {
+        using run = detail::fused_run<F, typename std::decay<Args>::type...>;
+        std::uint8_t buf[run::size];
+        this->read(buf, sizeof(buf));
+        return fuse<run::length>(buf, std::forward<Args>(args)...);
+    }
+
+    template<std::size_t N, typename Head, typename... Tail>
+    typename std::enable_if<N != 0, this_type&>::type
+    fuse(const std::uint8_t *p, Head &&head, Tail&&... tail) {
+        return fuse<N - 1>(this->get_fixed(p, head), std::forward<Tail>(tail)...);
+    }
+
+    template<std::size_t N, typename... Tail>
+    typename std::enable_if<N == 0, this_type&>::type
+    fuse(const std::uint8_t *, Tail&&... tail) {
+        return serialize(std::forward<Tail>(tail)...);
+    }
 };
 
 /***************************************************************************/
@@ -53,6 +53,15 @@
 #include <yas/types/utility/object.hpp>
 #include <yas/types/utility/asis.hpp>
 #include <yas/types/utility/init.hpp>
+#include <yas/types/utility/delta.hpp>
+#include <yas/types/utility/timeseries.hpp>
+#include <yas/types/utility/columnar.hpp>
+#include <yas/types/utility/presence.hpp>
+#include <yas/types/utility/narrow.hpp>
+#include <yas/types/utility/quantize.hpp>
+#include <yas/types/utility/rle.hpp>
+#include <yas/types/utility/sparse.hpp>
+#include <yas/types/utility/string_table.hpp>
 
 #include <yas/buffers.hpp>
 #include <yas/object.hpp>
@@ -93,7 +102,8 @@ struct binary_oarchive
 
     template<typename Head, typename... Tail>
     this_type& serialize(const Head &head, const Tail&... tail) {
-        return operator& (head).serialize(tail...);
+        using run = detail::fused_run<F, Head, Tail...>;
+        return serialize_run(std::integral_constant<bool, (run::length > 1)>{}, head, tail...);
     }
 
     template<typename... Args>
@@ -105,6 +115,34 @@ struct binary_oarchive
     this_type& save(const Args&... args) {
         return serialize(args...);
     }
+
+private:
+    template<typename Head, typename... Tail>
+    this_type& serialize_run(std::false_type, const Head &head, const Tail&... tail) {
+        return operator& (head).serialize(tail...);
+    }
+
+    // the leading run of the fixed-size fundamentals is stored into the
+    // buffer and written by one call
+    template<typename... Args>
+    this_type& serialize_run(std::true_type, const Args&... args) {
+        using run = detail::fused_run<F, Args...>;
+        std::uint8_t buf[run::size];
+        return fuse<run::length>(buf, buf, args...);
+    }
+
+    template<std::size_t N, typename Head, typename... Tail>
+    typename std::enable_if<N != 0, this_type&>::type
+    fuse(std::uint8_t *buf, std::uint8_t *p, const Head &head, const Tail&... tail) {
+        return fuse<N - 1>(buf, this->put_fixed(p, head), tail...);
+    }
+
+    template<std::size_t N, typename... Tail>
+    typename std::enable_if<N == 0, this_type&>::type
+    fuse(std::uint8_t *buf, std::uint8_t *p, const Tail&... tail) {
+        this->write(buf, __YAS_SCAST(std::size_t, p - buf));
+        return serialize(tail...);
+    }
 };
 
 /***************************************************************************/
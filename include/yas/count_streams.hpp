@@ -36,6 +36,8 @@
 #ifndef __yas__count_streams_hpp
 #define __yas__count_streams_hpp
 
+#include <yas/detail/type_traits/serialized_size.hpp>
+
 #include <cmath>
 #include <cstring>
 
@@ -55,7 +57,17 @@ struct count_ostream {
     }
 
     std::size_t total_size;
-}; // struct null_ostream
+}; // struct count_ostream
+
+/***************************************************************************/
+
+namespace detail {
+
+template<>
+struct is_count_stream<count_ostream>: std::true_type
+{};
+
+} // ns detail
 
 /***************************************************************************/
 
@@ -67,6 +67,25 @@
 #   define YAS_VARIANT_MAX_VARIANTS 20
 #endif // YAS_VARIANT_MAX_VARIANTS
 
+/***************************************************************************/
+// the SIMD instruction sets available at compile time.
+// define YAS_NO_SIMD to use the scalar code only.
+
+#ifndef YAS_NO_SIMD
+#   if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#       define __YAS_SSE2 1
+#   endif
+#   if defined(__SSSE3__) || defined(__AVX__)
+#       define __YAS_SSSE3 1
+#   endif
+#   if defined(__AVX2__)
+#       define __YAS_AVX2 1
+#   endif
+#   if defined(__F16C__)
+#       define __YAS_F16C 1
+#   endif
+#endif // YAS_NO_SIMD
+
 /***************************************************************************/
 
 #include <yas/detail/config/endian.hpp>
@@ -41,10 +41,15 @@
 #include <yas/detail/io/io_exceptions.hpp>
 #include <yas/detail/io/serialization_exceptions.hpp>
 #include <yas/detail/io/endian_conv.hpp>
+#include <yas/detail/io/int_block_codec.hpp>
+#include <yas/detail/io/narrow_codec.hpp>
 #include <yas/detail/type_traits/type_traits.hpp>
 #include <yas/detail/tools/cast.hpp>
+#include <yas/detail/tools/strings_dict.hpp>
 #include <yas/tools/wrap_asis.hpp>
 
+#include <cstring>
+
 namespace yas {
 namespace detail {
 
@@ -68,9 +73,57 @@ struct binary_ostream {
         __YAS_THROW_WRITE_ERROR(size != os.write(ptr, size));
     }
 
+    // stores the fixed-size fundamental into the buffer of the fused run,
+    // see can_be_fused
+    template<typename T>
+    static std::uint8_t* put_fixed(std::uint8_t *p, const T &v) {
+        const auto t = to_stored(v, std::integral_constant<bool, __YAS_BSWAP_NEEDED(F) && sizeof(T) != 1>{});
+        std::memcpy(p, &t, sizeof(t));
+        return p + sizeof(t);
+    }
+
+    // for arrays which needs to be byte-swapped
+    template<typename T>
+    void write_bswapped(const T *ptr, std::size_t size) {
+        enum { chunk = 4096 / sizeof(T) };
+        T buf[chunk];
+        while ( size ) {
+            const std::size_t n = (size < chunk) ? size : __YAS_SCAST(std::size_t, chunk);
+            endian_converter::bswap(buf, ptr, n);
+            __YAS_THROW_WRITE_ERROR(sizeof(T) * n != os.write(buf, sizeof(T) * n));
+            ptr += n;
+            size -= n;
+        }
+    }
+
+    // for arrays of integers in compacted mode
+    template<typename T>
+    void write_int_block(const T *ptr, std::size_t size) {
+        int_block_codec::encode(os, ptr, size);
+    }
+
+    // for floats and doubles wrapped by 'yas::narrow()' in compacted mode
+    template<typename T>
+    void write_narrowed(const T &v) {
+        narrow_codec::encode(os, v);
+    }
+
+    // for strings of the archives with 'yas::interned'
+    void write_interned(const char *ptr, std::size_t size) {
+        if ( strings_dict::internable(size) ) {
+            const auto res = dict.insert(ptr, size);
+            if ( res.second ) {
+                write_varint((res.first << 1) | 1u);
+                return;
+            }
+        }
+        write_varint(size << 1);
+        __YAS_THROW_WRITE_ERROR(size != os.write(ptr, size));
+    }
+
     template<typename T>
     void write(const asis_wrapper<T> &v) {
-        binary_ostream<OS, (F & ~yas::compacted)>{os}.write(v.val);
+        binary_ostream<OS, (F & ~(yas::compacted|yas::interned))>{os}.write(v.val);
     }
 
     template<typename T>
@@ -150,8 +203,35 @@ struct binary_ostream {
         }
     }
 
+private:
+    template<typename T>
+    static T to_stored(const T &v, std::false_type) { return v; }
+    template<typename T>
+    static T to_stored(const T &v, std::true_type, __YAS_DISABLE_IF_IS_ANY_OF(T, float, double)) {
+        return endian_converter::bswap(v);
+    }
+    template<typename T>
+    static auto to_stored(const T &v, std::true_type, __YAS_ENABLE_IF_IS_ANY_OF(T, float, double))
+        -> decltype(endian_converter::to_network(v))
+    {
+        return endian_converter::to_network(v);
+    }
+
 private:
     OS &os;
+    typename std::conditional<(F & yas::interned) != 0, strings_dict_writer, no_strings_dict>::type dict;
+
+public:
+    // LEB128, for the interned strings and the counts of 'yas::rle()'/'yas::sparse()'
+    void write_varint(std::size_t v) {
+        std::uint8_t buf[10];
+        std::size_t n = 0;
+        for ( ; v >= 0x80u; v >>= 7 ) {
+            buf[n++] = __YAS_SCAST(std::uint8_t, v | 0x80u);
+        }
+        buf[n++] = __YAS_SCAST(std::uint8_t, v);
+        __YAS_THROW_WRITE_ERROR(n != os.write(buf, n));
+    }
 
 private:
     template<typename T>
@@ -207,9 +287,55 @@ struct binary_istream {
         return size;
     }
 
+    // for arrays which needs to be byte-swapped
+    template<typename T>
+    void read_bswapped(T *ptr, std::size_t size) {
+        __YAS_THROW_READ_ERROR(sizeof(T) * size != is.read(ptr, sizeof(T) * size));
+        endian_converter::bswap(ptr, ptr, size);
+    }
+
+    // for arrays of integers in compacted mode
+    template<typename T>
+    void read_int_block(T *ptr, std::size_t size) {
+        int_block_codec::decode(is, ptr, size);
+    }
+
+    // for floats and doubles wrapped by 'yas::narrow()' in compacted mode
+    template<typename T>
+    void read_narrowed(T &v) {
+        narrow_codec::decode(is, v);
+    }
+
+    // for strings of the archives with 'yas::interned'
+    template<typename S>
+    void read_interned(S &str) {
+        const std::size_t tag = read_varint();
+        if ( tag & 1u ) {
+            const std::string *s = dict.find(tag >> 1);
+            if ( !s ) { __YAS_THROW_BAD_STRING_REFERENCE(); }
+            str.assign(s->data(), s->size());
+            return;
+        }
+
+        const std::size_t size = tag >> 1;
+        str.resize(size);
+        __YAS_THROW_READ_ERROR(size != is.read(__YAS_CCAST(char*, str.data()), size));
+        if ( strings_dict::internable(size) ) {
+            dict.insert(str.data(), size);
+        }
+    }
+
     template<typename T>
     void read(asis_wrapper<T> &v) {
-        binary_istream<IS, (F & ~yas::compacted)>{is}.read(v.val);
+        binary_istream<IS, (F & ~(yas::compacted|yas::interned))>{is}.read(v.val);
+    }
+
+    // loads the fixed-size fundamental from the buffer of the fused run,
+    // see can_be_fused
+    template<typename T>
+    static const std::uint8_t* get_fixed(const std::uint8_t *p, T &v) {
+        from_stored(p, v, std::integral_constant<bool, __YAS_BSWAP_NEEDED(F) && sizeof(T) != 1>{});
+        return p + sizeof(T);
     }
 
     // for chars & bools
@@ -275,8 +401,42 @@ struct binary_istream {
         }
     }
 
+private:
+    template<typename T>
+    static void from_stored(const std::uint8_t *p, T &v, std::false_type) {
+        std::memcpy(&v, p, sizeof(v));
+    }
+    template<typename T>
+    static void from_stored(const std::uint8_t *p, T &v, std::true_type, __YAS_DISABLE_IF_IS_ANY_OF(T, float, double)) {
+        std::memcpy(&v, p, sizeof(v));
+        v = endian_converter::bswap(v);
+    }
+    template<typename T>
+    static void from_stored(const std::uint8_t *p, T &v, std::true_type, __YAS_ENABLE_IF_IS_ANY_OF(T, float, double)) {
+        typename storage_type<T>::type r;
+        std::memcpy(&r, p, sizeof(r));
+        v = endian_converter::template from_network<T>(r);
+    }
+
+public:
+    // LEB128, see binary_ostream::write_varint()
+    std::size_t read_varint() {
+        std::size_t v = 0;
+        for ( std::size_t shift = 0; ; shift += 7 ) {
+            __YAS_THROW_READ_STORAGE_SIZE_ERROR(shift >= sizeof(v) * 8);
+            const std::uint8_t b = __YAS_SCAST(std::uint8_t, is.getch());
+            v |= __YAS_SCAST(std::size_t, b & 0x7fu) << shift;
+            if ( !(b & 0x80u) ) {
+                break;
+            }
+        }
+
+        return v;
+    }
+
 private:
     IS &is;
+    typename std::conditional<(F & yas::interned) != 0, strings_dict_reader, no_strings_dict>::type dict;
 };
 
 /**************************************************************************/
@@ -38,6 +38,13 @@
 
 #include <yas/detail/config/config.hpp>
 #include <yas/detail/type_traits/type_traits.hpp>
+#include <yas/detail/tools/cast.hpp>
+
+#include <cstring>
+
+#if defined(__YAS_SSSE3) || defined(__YAS_AVX2)
+#	include <immintrin.h>
+#endif
 
 namespace yas {
 namespace detail {
@@ -59,6 +66,16 @@ struct storage_type {
 	>::type;
 };
 
+template<std::size_t S>
+struct unsigned_of_size;
+
+template<>
+struct unsigned_of_size<2> { using type = std::uint16_t; };
+template<>
+struct unsigned_of_size<4> { using type = std::uint32_t; };
+template<>
+struct unsigned_of_size<8> { using type = std::uint64_t; };
+
 struct endian_converter {
 	template<typename T>
 	static T bswap(const T &v, __YAS_ENABLE_IF_IS_16BIT(T))
@@ -95,6 +112,67 @@ struct endian_converter {
 
 		return u.v;
 	}
+
+	// for arrays of 16/32/64-bit integers, floats and doubles.
+	// the 'dst' and 'src' can point to the same array.
+	template<typename T>
+	static void bswap(T *dst, const T *src, std::size_t size) {
+		static_assert(sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8, "unexpected element size");
+		using U = typename unsigned_of_size<sizeof(T)>::type;
+
+		const std::uint8_t *sp = __YAS_RCAST(const std::uint8_t *, src);
+		std::uint8_t *dp = __YAS_RCAST(std::uint8_t *, dst);
+		std::size_t pos = 0;
+
+#if defined(__YAS_SSSE3) || defined(__YAS_AVX2)
+		const std::size_t bytes = size * sizeof(T);
+		const std::uint8_t *m = bswap_shuffle_mask(std::integral_constant<std::size_t, sizeof(T)>{});
+#endif
+#if defined(__YAS_AVX2)
+		const __m256i mask32 = _mm256_load_si256(__YAS_RCAST(const __m256i *, m));
+		for ( ; pos + 32 <= bytes; pos += 32 ) {
+			const __m256i v = _mm256_loadu_si256(__YAS_RCAST(const __m256i *, sp + pos));
+			_mm256_storeu_si256(__YAS_RCAST(__m256i *, dp + pos), _mm256_shuffle_epi8(v, mask32));
+		}
+#endif
+#if defined(__YAS_SSSE3)
+		const __m128i mask16 = _mm_load_si128(__YAS_RCAST(const __m128i *, m));
+		for ( ; pos + 16 <= bytes; pos += 16 ) {
+			const __m128i v = _mm_loadu_si128(__YAS_RCAST(const __m128i *, sp + pos));
+			_mm_storeu_si128(__YAS_RCAST(__m128i *, dp + pos), _mm_shuffle_epi8(v, mask16));
+		}
+#endif
+		for ( std::size_t idx = pos / sizeof(T); idx < size; ++idx ) {
+			U u;
+			std::memcpy(&u, sp + idx * sizeof(T), sizeof(u));
+			u = bswap(u);
+			std::memcpy(dp + idx * sizeof(T), &u, sizeof(u));
+		}
+	}
+
+private:
+	// the 'pshufb' masks, the indexes are relative to the 128-bit lane
+	static const std::uint8_t* bswap_shuffle_mask(std::integral_constant<std::size_t, 2>) {
+		alignas(32) static const std::uint8_t m[32] = {
+			 1, 0, 3, 2, 5, 4, 7, 6, 9, 8,11,10,13,12,15,14
+			,1, 0, 3, 2, 5, 4, 7, 6, 9, 8,11,10,13,12,15,14
+		};
+		return m;
+	}
+	static const std::uint8_t* bswap_shuffle_mask(std::integral_constant<std::size_t, 4>) {
+		alignas(32) static const std::uint8_t m[32] = {
+			 3, 2, 1, 0, 7, 6, 5, 4,11,10, 9, 8,15,14,13,12
+			,3, 2, 1, 0, 7, 6, 5, 4,11,10, 9, 8,15,14,13,12
+		};
+		return m;
+	}
+	static const std::uint8_t* bswap_shuffle_mask(std::integral_constant<std::size_t, 8>) {
+		alignas(32) static const std::uint8_t m[32] = {
+			 7, 6, 5, 4, 3, 2, 1, 0,15,14,13,12,11,10, 9, 8
+			,7, 6, 5, 4, 3, 2, 1, 0,15,14,13,12,11,10, 9, 8
+		};
+		return m;
+	}
 };
 
 /***************************************************************************/
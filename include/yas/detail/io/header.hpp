@@ -59,7 +59,11 @@ union archive_header {
         std::uint8_t type      :3; // archive type : 0...7: binary, text, json
         std::uint8_t endian    :1; // endianness   : 0 - LE, 1 - BE
         std::uint8_t compacted :1; // compacted    : 0 - no, 1 - yes
-        std::uint8_t reserved  :7; // reserved
+        std::uint8_t interned  :1; // interned     : 0 - no, 1 - yes
+        std::uint8_t raw_wide  :1; // raw wide     : 0 - no, 1 - yes
+        std::uint8_t int_blocks:1; // int blocks   : 0 - no, 1 - yes
+        std::uint8_t packed_bools:1; // packed bools : 0 - no, 1 - yes
+        std::uint8_t reserved  :3; // reserved
     } bits;
 
     std::uint16_t u;
@@ -182,12 +186,20 @@ struct oarchive_header {
                 ,((F & options::ehost) ? __YAS_BIG_ENDIAN : (F & options::ebig) ? 1 : 0)
             );
             constexpr bool compacted = __YAS_SCAST(bool, (F & yas::compacted));
+            constexpr bool interned = __YAS_SCAST(bool, (F & yas::binary) && (F & yas::interned));
+            constexpr bool raw_wide = __YAS_SCAST(bool, (F & yas::binary) && (F & yas::raw_wide));
+            constexpr bool int_blocks = __YAS_SCAST(bool, (F & yas::binary) && (F & yas::int_blocks));
+            constexpr bool packed_bools = __YAS_SCAST(bool, (F & yas::binary) && (F & yas::packed_bools));
 
             const header::archive_header header = {{
                  __YAS_SCAST(std::uint8_t, version() & 15)
                 ,__YAS_SCAST(std::uint8_t, artype)
                 ,__YAS_SCAST(std::uint8_t, endian)
                 ,__YAS_SCAST(std::uint8_t, compacted)
+                ,__YAS_SCAST(std::uint8_t, interned)
+                ,__YAS_SCAST(std::uint8_t, raw_wide)
+                ,__YAS_SCAST(std::uint8_t, int_blocks)
+                ,__YAS_SCAST(std::uint8_t, packed_bools)
                 ,__YAS_SCAST(std::uint8_t, 0u) // reserved
             }};
 
@@ -215,6 +227,10 @@ struct oarchive_header {
     static constexpr options host_endian() { return __YAS_BIG_ENDIAN ? options::ebig : options::elittle; }
 
     static constexpr bool compacted() { return __YAS_SCAST(bool, (F & yas::compacted)); }
+    static constexpr bool interned() { return __YAS_SCAST(bool, (F & yas::binary) && (F & yas::interned)); }
+    static constexpr bool raw_wide() { return __YAS_SCAST(bool, (F & yas::binary) && (F & yas::raw_wide)); }
+    static constexpr bool int_blocks() { return __YAS_SCAST(bool, (F & yas::binary) && (F & yas::int_blocks)); }
+    static constexpr bool packed_bools() { return __YAS_SCAST(bool, (F & yas::binary) && (F & yas::packed_bools)); }
     static constexpr std::size_t version() { return archive_version<type()>::value; }
 
     static constexpr bool is_readable() { return false; }
@@ -249,6 +265,22 @@ struct iarchive_header {
             if ( F & yas::compacted && !header.bits.compacted ) {
                 __YAS_THROW_BAD_COMPACTED_MODE()
             }
+
+            if ( (F & yas::binary) && __YAS_SCAST(bool, F & yas::interned) != __YAS_SCAST(bool, header.bits.interned) ) {
+                __YAS_THROW_BAD_INTERNED_MODE()
+            }
+
+            if ( (F & yas::binary) && __YAS_SCAST(bool, F & yas::raw_wide) != __YAS_SCAST(bool, header.bits.raw_wide) ) {
+                __YAS_THROW_BAD_RAW_WIDE_MODE()
+            }
+
+            if ( (F & yas::binary) && __YAS_SCAST(bool, F & yas::int_blocks) != __YAS_SCAST(bool, header.bits.int_blocks) ) {
+                __YAS_THROW_BAD_INT_BLOCKS_MODE()
+            }
+
+            if ( (F & yas::binary) && __YAS_SCAST(bool, F & yas::packed_bools) != __YAS_SCAST(bool, header.bits.packed_bools) ) {
+                __YAS_THROW_BAD_PACKED_BOOLS_MODE()
+            }
         }
 
         __YAS_CONSTEXPR_IF( F & yas::json ) {
@@ -284,6 +316,30 @@ struct iarchive_header {
         return header.bits.compacted;
     }
 
+    bool interned() const {
+        __YAS_CHECK_IF_HEADER_INITED()
+
+        return header.bits.interned;
+    }
+
+    bool raw_wide() const {
+        __YAS_CHECK_IF_HEADER_INITED()
+
+        return header.bits.raw_wide;
+    }
+
+    bool int_blocks() const {
+        __YAS_CHECK_IF_HEADER_INITED()
+
+        return header.bits.int_blocks;
+    }
+
+    bool packed_bools() const {
+        __YAS_CHECK_IF_HEADER_INITED()
+
+        return header.bits.packed_bools;
+    }
+
     std::size_t version() const {
         __YAS_CHECK_IF_HEADER_INITED()
 
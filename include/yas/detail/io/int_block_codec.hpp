@@ -0,0 +1,375 @@
+
+// Copyright (c) 2010-2021 niXman (github dot nixman at pm dot me). All
+// rights reserved.
+//
+// This file is part of YAS(https://github.com/niXman/yas) project.
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//
+//
+// Boost Software License - Version 1.0 - August 17th, 2003
+//
+// Permission is hereby granted, free of charge, to any person or organization
+// obtaining a copy of the software and accompanying documentation covered by
+// this license (the "Software") to use, reproduce, display, distribute,
+// execute, and transmit the Software, and to prepare derivative works of the
+// Software, and to permit third-parties to whom the Software is furnished to
+// do so, all subject to the following:
+//
+// The copyright notices in the Software and this entire statement, including
+// the above license grant, this restriction and the following disclaimer,
+// must be included in all copies of the Software, in whole or in part, and
+// all derivative works of the Software, unless such copies or derivative
+// works are solely in the form of machine-executable object code generated by
+// a source language processor.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+// SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+// FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+
+
+#ifndef __yas__detail__io__int_block_codec_hpp
+#define __yas__detail__io__int_block_codec_hpp
+
+#include <yas/detail/config/config.hpp>
+#include <yas/detail/io/io_exceptions.hpp>
+#include <yas/detail/type_traits/type_traits.hpp>
+#include <yas/detail/tools/cast.hpp>
+
+#include <cstring>
+#include <type_traits>
+
+#if defined(__YAS_SSSE3)
+#   include <immintrin.h>
+#endif
+
+namespace yas {
+namespace detail {
+
+/***************************************************************************/
+
+// the codec for the arrays of 16/32/64-bit integers in compacted archives.
+// the array is split into the blocks of 'block_size' elements, and every block
+// is encoded by the smallest of:
+//   vbyte:   the 2-bit length codes of all the elements, then the elements bytes (Stream VByte)
+//   bitpack: the block minimum, the bits width, then the bit-packed differences from the minimum
+// the signed values are zigzag-encoded, all the bytes are little-endian.
+struct int_block_codec {
+    enum: std::size_t { block_size = 128 };
+    enum: std::uint8_t { vbyte = 0, bitpack = 1 };
+
+    template<typename OS, typename T>
+    static void encode(OS &os, const T *ptr, std::size_t size) {
+        using U = typename std::make_unsigned<T>::type;
+
+        std::uint8_t buf[buf_size];
+        U u[block_size];
+        while ( size ) {
+            const std::size_t n = (size < block_size) ? size : __YAS_SCAST(std::size_t, block_size);
+
+            U lo = __YAS_SCAST(U, ~U{}), hi = 0;
+            std::size_t vsize = (n + 3) / 4;
+            for ( std::size_t i = 0; i < n; ++i ) {
+                u[i] = zigzag(ptr[i]);
+                lo = (u[i] < lo) ? u[i] : lo;
+                hi = (u[i] > hi) ? u[i] : hi;
+                vsize += vbyte_len<U>(vbyte_code(u[i]));
+            }
+            const std::size_t width = bits_width(__YAS_SCAST(U, hi - lo));
+            const std::size_t bsize = 2 + bytes_width(lo) + (n * width + 7) / 8;
+
+            std::size_t wsize = 0;
+            if ( vsize <= bsize ) {
+                wsize = encode_vbyte(buf, u, n, vsize);
+            } else {
+                wsize = encode_bitpack(buf, u, n, lo, width);
+            }
+            __YAS_THROW_WRITE_ERROR(wsize != os.write(buf, wsize));
+
+            ptr += n;
+            size -= n;
+        }
+    }
+
+    template<typename IS, typename T>
+    static void decode(IS &is, T *ptr, std::size_t size) {
+        using U = typename std::make_unsigned<T>::type;
+
+        std::uint8_t buf[buf_size];
+        while ( size ) {
+            const std::size_t n = (size < block_size) ? size : __YAS_SCAST(std::size_t, block_size);
+
+            std::uint8_t codec = 0;
+            __YAS_THROW_READ_ERROR(1 != is.read(&codec, 1));
+            if ( codec == vbyte ) {
+                decode_vbyte<U>(is, buf, ptr, n);
+            } else {
+                __YAS_THROW_READ_STORAGE_SIZE_ERROR(codec != bitpack);
+                decode_bitpack<U>(is, buf, ptr, n);
+            }
+
+            ptr += n;
+            size -= n;
+        }
+    }
+
+    // the unaligned little-endian access, shared with the other codecs
+    static std::uint64_t load_le64(const std::uint8_t *p) {
+#if __YAS_LITTLE_ENDIAN
+        std::uint64_t v;
+        std::memcpy(&v, p, sizeof(v));
+        return v;
+#else
+        return load_le(p, 8);
+#endif
+    }
+
+    static void store_le64(std::uint8_t *p, std::uint64_t v) {
+#if __YAS_LITTLE_ENDIAN
+        std::memcpy(p, &v, sizeof(v));
+#else
+        store_le(p, v, 8);
+#endif
+    }
+
+private:
+    // the largest encoded block, plus the padding for the unaligned loads
+    enum: std::size_t { padding = 16, buf_size = 2 + 8 + block_size / 4 + block_size * 8 + padding };
+
+    template<typename T>
+    static typename std::make_unsigned<T>::type zigzag(const T &v, __YAS_ENABLE_IF_IS_SIGNED_INTEGER(T)) {
+        using U = typename std::make_unsigned<T>::type;
+        return __YAS_SCAST(U, (__YAS_SCAST(U, v) << 1) ^ __YAS_SCAST(U, -__YAS_SCAST(U, __YAS_SCAST(U, v) >> (sizeof(T) * 8 - 1))));
+    }
+    template<typename T>
+    static T zigzag(const T &v, __YAS_ENABLE_IF_IS_UNSIGNED_INTEGER(T)) { return v; }
+
+    template<typename T, typename U>
+    static T unzigzag(const U &u, __YAS_ENABLE_IF_IS_SIGNED_INTEGER(T)) {
+        return __YAS_SCAST(T, __YAS_SCAST(U, (u >> 1) ^ __YAS_SCAST(U, -__YAS_SCAST(U, u & 1u))));
+    }
+    template<typename T, typename U>
+    static T unzigzag(const U &u, __YAS_ENABLE_IF_IS_UNSIGNED_INTEGER(T)) { return u; }
+
+    // the element lengths are 1..4 bytes for up to 32-bit, and 1/2/4/8 bytes for 64-bit
+    template<typename U>
+    static std::size_t vbyte_len(std::size_t code) {
+        return (sizeof(U) == 8) ? (__YAS_SCAST(std::size_t, 1u) << code) : code + 1;
+    }
+    template<typename U>
+    static std::size_t vbyte_code(const U &v) {
+        // without branches, the lengths are unpredictable
+        const std::uint64_t v64 = v;
+        return __YAS_SCAST(std::size_t, v64 > 0xffu) + __YAS_SCAST(std::size_t, v64 > 0xffffu)
+            + __YAS_SCAST(std::size_t, v64 > ((sizeof(U) == 8) ? 0xffffffffull : 0xffffffull));
+    }
+
+    template<typename U>
+    static std::size_t bits_width(U v) {
+        std::size_t r = 0;
+        for ( ; v; v >>= 1 ) { ++r; }
+        return r;
+    }
+    template<typename U>
+    static std::size_t bytes_width(const U &v) {
+        return (bits_width(v) + 7) / 8;
+    }
+
+    static void store_le(std::uint8_t *p, std::uint64_t v, std::size_t bytes) {
+        for ( std::size_t i = 0; i < bytes; ++i, v >>= 8 ) {
+            p[i] = __YAS_SCAST(std::uint8_t, v);
+        }
+    }
+    static std::uint64_t load_le(const std::uint8_t *p, std::size_t bytes) {
+        std::uint64_t v = 0;
+        for ( std::size_t i = 0; i < bytes; ++i ) {
+            v |= __YAS_SCAST(std::uint64_t, p[i]) << (i * 8);
+        }
+        return v;
+    }
+    template<typename U>
+    static std::size_t encode_vbyte(std::uint8_t *buf, const U *u, std::size_t n, std::size_t vsize) {
+        buf[0] = vbyte;
+        std::uint8_t *ctrl = buf + 1;
+        std::uint8_t *data = ctrl + (n + 3) / 4;
+        std::memset(ctrl, 0, (n + 3) / 4);
+        for ( std::size_t i = 0; i < n; ++i ) {
+            const std::size_t code = vbyte_code(u[i]);
+            const std::size_t len = vbyte_len<U>(code);
+            ctrl[i / 4] |= __YAS_SCAST(std::uint8_t, code << ((i % 4) * 2));
+            store_le(data, u[i], len);
+            data += len;
+        }
+
+        return 1 + vsize;
+    }
+
+    template<typename U>
+    static std::size_t encode_bitpack(std::uint8_t *buf, const U *u, std::size_t n, U lo, std::size_t width) {
+        const std::size_t lobytes = bytes_width(lo);
+        buf[0] = bitpack;
+        buf[1] = __YAS_SCAST(std::uint8_t, lobytes);
+        store_le(buf + 2, lo, lobytes);
+        buf[2 + lobytes] = __YAS_SCAST(std::uint8_t, width);
+
+        std::uint8_t *data = buf + 3 + lobytes;
+        const std::size_t dsize = (n * width + 7) / 8;
+        std::memset(data, 0, dsize + padding);
+        if ( width <= 56 ) {
+            // less than a byte is pending before every element
+            std::uint64_t acc = 0;
+            std::size_t bits = 0;
+            for ( std::size_t i = 0; i < n; ++i ) {
+                acc |= __YAS_SCAST(std::uint64_t, __YAS_SCAST(U, u[i] - lo)) << bits;
+                bits += width;
+                store_le64(data, acc);
+                data += bits / 8;
+                acc >>= bits / 8 * 8;
+                bits %= 8;
+            }
+            store_le64(data, acc);
+
+            return 3 + lobytes + dsize;
+        }
+
+        for ( std::size_t i = 0, pos = 0; i < n; ++i, pos += width ) {
+            std::uint64_t v = __YAS_SCAST(std::uint64_t, __YAS_SCAST(U, u[i] - lo));
+            for ( std::size_t bit = pos, left = width; left; ) {
+                const std::size_t shift = bit % 8;
+                const std::size_t take = (8 - shift < left) ? 8 - shift : left;
+                data[bit / 8] |= __YAS_SCAST(std::uint8_t, v << shift);
+                v >>= take;
+                bit += take;
+                left -= take;
+            }
+        }
+
+        return 3 + lobytes + dsize;
+    }
+
+    template<typename U, typename IS, typename T>
+    static void decode_vbyte(IS &is, std::uint8_t *buf, T *ptr, std::size_t n) {
+        const std::size_t csize = (n + 3) / 4;
+        std::uint8_t *ctrl = buf;
+        __YAS_THROW_READ_ERROR(csize != is.read(ctrl, csize));
+
+        std::size_t dsize = 0;
+        for ( std::size_t i = 0; i < n; ++i ) {
+            dsize += vbyte_len<U>((ctrl[i / 4] >> ((i % 4) * 2)) & 3u);
+        }
+        __YAS_THROW_READ_ERROR(dsize != is.read(ctrl + csize, dsize));
+        std::memset(ctrl + csize + dsize, 0, padding);
+
+        const std::uint8_t *data = ctrl + csize;
+        std::size_t i = vbyte_decode_simd(ctrl, data, ptr, n, std::integral_constant<bool, sizeof(T) == 4>{});
+        for ( ; i < n; ++i ) {
+            const std::size_t len = vbyte_len<U>((ctrl[i / 4] >> ((i % 4) * 2)) & 3u);
+            __YAS_THROW_READ_STORAGE_SIZE_ERROR(len > sizeof(U));
+            ptr[i] = unzigzag<T>(__YAS_SCAST(U, load_le(data, len)));
+            data += len;
+        }
+    }
+
+    template<typename U, typename IS, typename T>
+    static void decode_bitpack(IS &is, std::uint8_t *buf, T *ptr, std::size_t n) {
+        std::uint8_t lobytes = 0;
+        __YAS_THROW_READ_ERROR(1 != is.read(&lobytes, 1));
+        __YAS_THROW_READ_STORAGE_SIZE_ERROR(lobytes > sizeof(U));
+        __YAS_THROW_READ_ERROR(lobytes + 1u != is.read(buf, lobytes + 1u));
+        const U lo = __YAS_SCAST(U, load_le(buf, lobytes));
+        const std::size_t width = buf[lobytes];
+        __YAS_THROW_READ_STORAGE_SIZE_ERROR(width > sizeof(U) * 8);
+
+        const std::size_t dsize = (n * width + 7) / 8;
+        std::uint8_t *data = buf;
+        __YAS_THROW_READ_ERROR(dsize != is.read(data, dsize));
+        std::memset(data + dsize, 0, padding);
+
+        if ( width == 0 ) {
+            const T v = unzigzag<T>(lo);
+            for ( std::size_t i = 0; i < n; ++i ) {
+                ptr[i] = v;
+            }
+        } else if ( width <= 56 ) {
+            const std::uint64_t mask = (__YAS_SCAST(std::uint64_t, 1u) << width) - 1;
+            for ( std::size_t i = 0, pos = 0; i < n; ++i, pos += width ) {
+                const std::uint64_t v = (load_le64(data + pos / 8) >> (pos % 8)) & mask;
+                ptr[i] = unzigzag<T>(__YAS_SCAST(U, lo + __YAS_SCAST(U, v)));
+            }
+        } else {
+            // the element can span nine bytes
+            const std::uint64_t mask = (width == 64) ? ~__YAS_SCAST(std::uint64_t, 0u) : (__YAS_SCAST(std::uint64_t, 1u) << width) - 1;
+            for ( std::size_t i = 0, pos = 0; i < n; ++i, pos += width ) {
+                const std::size_t shift = pos % 8;
+                std::uint64_t v = load_le64(data + pos / 8) >> shift;
+                if ( shift ) {
+                    v |= __YAS_SCAST(std::uint64_t, data[pos / 8 + 8]) << (64 - shift);
+                }
+                ptr[i] = unzigzag<T>(__YAS_SCAST(U, lo + __YAS_SCAST(U, v & mask)));
+            }
+        }
+    }
+
+#if defined(__YAS_SSSE3)
+    struct vbyte_tables {
+        std::uint8_t shuffle[256][16];
+        std::uint8_t length[256];
+
+        vbyte_tables() {
+            for ( std::size_t c = 0; c < 256; ++c ) {
+                std::size_t off = 0;
+                for ( std::size_t e = 0; e < 4; ++e ) {
+                    const std::size_t len = ((c >> (e * 2)) & 3u) + 1;
+                    for ( std::size_t b = 0; b < 4; ++b ) {
+                        shuffle[c][e * 4 + b] = __YAS_SCAST(std::uint8_t, (b < len) ? off + b : 0x80u);
+                    }
+                    off += len;
+                }
+                length[c] = __YAS_SCAST(std::uint8_t, off);
+            }
+        }
+    };
+    static const vbyte_tables& tables() {
+        static const vbyte_tables t;
+        return t;
+    }
+
+    // four 32-bit elements per the control byte
+    template<typename T>
+    static std::size_t vbyte_decode_simd(const std::uint8_t *ctrl, const std::uint8_t *&data, T *ptr, std::size_t n, std::true_type) {
+        const vbyte_tables &t = tables();
+        const __m128i one = _mm_set1_epi32(1);
+        std::size_t i = 0;
+        for ( ; i + 4 <= n; i += 4 ) {
+            const std::uint8_t c = ctrl[i / 4];
+            __m128i v = _mm_loadu_si128(__YAS_RCAST(const __m128i *, data));
+            v = _mm_shuffle_epi8(v, _mm_loadu_si128(__YAS_RCAST(const __m128i *, t.shuffle[c])));
+            __YAS_CONSTEXPR_IF ( std::is_signed<T>::value ) {
+                v = _mm_xor_si128(_mm_srli_epi32(v, 1), _mm_sub_epi32(_mm_setzero_si128(), _mm_and_si128(v, one)));
+            }
+            _mm_storeu_si128(__YAS_RCAST(__m128i *, ptr + i), v);
+            data += t.length[c];
+        }
+
+        return i;
+    }
+#endif // __YAS_SSSE3
+
+    template<typename T, bool B>
+    static std::size_t vbyte_decode_simd(const std::uint8_t *, const std::uint8_t *&, T *, std::size_t, std::integral_constant<bool, B>) {
+        return 0;
+    }
+};
+
+/***************************************************************************/
+
+} // ns detail
+} // ns yas
+
+#endif // __yas__detail__io__int_block_codec_hpp
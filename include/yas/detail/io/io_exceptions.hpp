@@ -89,6 +89,27 @@ __YAS_DECLARE_EXCEPTION_TYPE(io_exception)
 #define __YAS_THROW_BAD_COMPACTED_MODE() \
     __YAS_THROW_EXCEPTION(::yas::io_exception, "incompatible compacted/non-compacted mode");
 
+#define __YAS_THROW_BAD_INTERNED_MODE() \
+    __YAS_THROW_EXCEPTION(::yas::io_exception, "incompatible interned/non-interned mode");
+
+#define __YAS_THROW_BAD_RAW_WIDE_MODE() \
+    __YAS_THROW_EXCEPTION(::yas::io_exception, "incompatible raw_wide/non-raw_wide mode");
+
+#define __YAS_THROW_BAD_INT_BLOCKS_MODE() \
+    __YAS_THROW_EXCEPTION(::yas::io_exception, "incompatible int_blocks/non-int_blocks mode");
+
+#define __YAS_THROW_BAD_PACKED_BOOLS_MODE() \
+    __YAS_THROW_EXCEPTION(::yas::io_exception, "incompatible packed_bools/non-packed_bools mode");
+
+#define __YAS_THROW_BAD_STRING_REFERENCE() \
+    __YAS_THROW_EXCEPTION(::yas::io_exception, "bad interned string reference");
+
+#define __YAS_THROW_BAD_COLUMN_SIZE() \
+    __YAS_THROW_EXCEPTION(::yas::io_exception, "column size mismatch");
+
+#define __YAS_THROW_BAD_RUN_LENGTH() \
+    __YAS_THROW_EXCEPTION(::yas::io_exception, "run length or index out of range");
+
 /***************************************************************************/
 
 } // namespace yas
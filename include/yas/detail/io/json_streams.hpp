@@ -43,9 +43,12 @@
 #include <yas/detail/type_traits/type_traits.hpp>
 #include <yas/detail/tools/cast.hpp>
 #include <yas/detail/tools/json_tools.hpp>
+#include <yas/detail/tools/json_index.hpp>
 #include <yas/tools/wrap_asis.hpp>
+#include <yas/buffers.hpp>
 
 #include <limits>
+#include <cstring>
 
 namespace yas {
 namespace detail {
@@ -144,8 +147,14 @@ private:
 
 template<typename IS, std::size_t F, typename Trait>
 struct json_istream {
+	// the input is in the contiguous memory and can be indexed
+	using is_indexable = std::integral_constant<bool,
+		has_intrusive_buffer<IS>::value && has_skip<IS>::value
+	>;
+
 	json_istream(IS &is)
         :is(is)
+        ,index()
 	{}
 
     std::size_t read_seq_size() {
@@ -160,6 +169,24 @@ struct json_istream {
 	char getch() { return is.getch(); }
 	void ungetch(char ch) { is.ungetch(ch); }
 
+	// the unread part of the input if the stream is contiguous in memory, empty otherwise
+	intrusive_buffer get_intrusive_buffer() const {
+		return get_intrusive_buffer(has_intrusive_buffer<IS>{});
+	}
+
+	// skips the string, the object or the array at the current position by
+	// the structural index. returns false if the stream is not indexable or
+	// there is no such value, the caller skips it char by char then
+	bool skip_value() {
+		return skip_value(is_indexable{});
+	}
+
+	// reads the chars of the key up to the closing quote, 'p' points to the
+	// key in the contiguous input or to the 'buf' otherwise
+	std::size_t read_key(char *buf, std::size_t size, const char *&p) {
+		return read_key(buf, size, p, is_indexable{});
+	}
+
 	// for arrays
 	std::size_t read(void *ptr, std::size_t size) {
 		__YAS_THROW_READ_ERROR(size != is.read(ptr, size));
@@ -208,17 +235,19 @@ struct json_istream {
 	template<typename T>
 	void read(T &v, __YAS_ENABLE_IF_IS_ANY_OF(T, std::int16_t, std::int32_t, std::int64_t)) {
 		char buf[sizeof(T)*4];
-		const std::size_t n = json_read_num(is, buf, (std::min)(sizeof(buf), is.available()));
-		v = Trait::template atoi<T>(buf, n);
+		const char *p = buf;
+		const std::size_t n = read_num(buf, sizeof(buf), p, is_indexable{});
+		v = Trait::template atoi<T>(p, n);
 	}
 
 	// for unsigned 16/32/64 bits
 	template<typename T>
 	void read(T &v, __YAS_ENABLE_IF_IS_ANY_OF(T, std::uint16_t, std::uint32_t, std::uint64_t)) {
 		char buf[sizeof(T)*4];
-		const std::size_t n = json_read_num(is, buf, (std::min)(sizeof(buf), is.available()));
+		const char *p = buf;
+		const std::size_t n = read_num(buf, sizeof(buf), p, is_indexable{});
 
-		v = Trait::template atou<T>(buf, n);
+		v = Trait::template atou<T>(p, n);
 	}
 
 	// for floats
@@ -258,7 +287,60 @@ struct json_istream {
 	}
 
 private:
+	intrusive_buffer get_intrusive_buffer(std::true_type) const { return is.get_intrusive_buffer(); }
+	intrusive_buffer get_intrusive_buffer(std::false_type) const { return intrusive_buffer(nullptr, 0); }
+
+	bool skip_value(std::true_type) {
+		const intrusive_buffer buf = is.get_intrusive_buffer();
+		if ( !buf.size || (*buf.data != '"' && *buf.data != '{' && *buf.data != '[') ) {
+			return false;
+		}
+
+		const char *end = (*buf.data == '"')
+			? json_string_end(buf.data, buf.data + buf.size)
+			: index.value_end(buf.data, buf.data + buf.size)
+		;
+		if ( !end ) {
+			return false;
+		}
+		is.skip(__YAS_SCAST(std::size_t, end - buf.data));
+
+		return true;
+	}
+	bool skip_value(std::false_type) { return false; }
+
+	std::size_t read_key(char *, std::size_t, const char *&p, std::true_type) {
+		const intrusive_buffer buf = is.get_intrusive_buffer();
+		const char *end = __YAS_SCAST(const char *, std::memchr(buf.data, '"', buf.size));
+		const std::size_t n = end ? __YAS_SCAST(std::size_t, end - buf.data) : buf.size;
+		p = buf.data;
+		is.skip(n);
+
+		return n;
+	}
+	std::size_t read_key(char *buf, std::size_t size, const char *&p, std::false_type) {
+		p = buf;
+
+		return json_read_key(is, buf, size);
+	}
+
+	// the contiguous input is parsed in place, 'p' points to the number
+	std::size_t read_num(char *, std::size_t size, const char *&p, std::true_type) {
+		const intrusive_buffer buf = is.get_intrusive_buffer();
+		const std::size_t n = json_num_run(buf.data, (std::min)(size, buf.size));
+		p = buf.data;
+		is.skip(n);
+
+		return n;
+	}
+	std::size_t read_num(char *buf, std::size_t size, const char *&p, std::false_type) {
+		p = buf;
+
+		return json_read_num(is, buf, (std::min)(size, is.available()));
+	}
+
 	IS &is;
+	json_structural_index index;
 };
 
 /***************************************************************************/
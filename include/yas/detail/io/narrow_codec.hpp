@@ -0,0 +1,184 @@
+
+// Copyright (c) 2010-2021 niXman (github dot nixman at pm dot me). All
+// rights reserved.
+//
+// This file is part of YAS(https://github.com/niXman/yas) project.
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//
+//
+// Boost Software License - Version 1.0 - August 17th, 2003
+//
+// Permission is hereby granted, free of charge, to any person or organization
+// obtaining a copy of the software and accompanying documentation covered by
+// this license (the "Software") to use, reproduce, display, distribute,
+// execute, and transmit the Software, and to prepare derivative works of the
+// Software, and to permit third-parties to whom the Software is furnished to
+// do so, all subject to the following:
+//
+// The copyright notices in the Software and this entire statement, including
+// the above license grant, this restriction and the following disclaimer,
+// must be included in all copies of the Software, in whole or in part, and
+// all derivative works of the Software, unless such copies or derivative
+// works are solely in the form of machine-executable object code generated by
+// a source language processor.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+// SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+// FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+
+
+#ifndef __yas__detail__io__narrow_codec_hpp
+#define __yas__detail__io__narrow_codec_hpp
+
+#include <yas/detail/config/config.hpp>
+#include <yas/detail/io/io_exceptions.hpp>
+#include <yas/detail/io/int_block_codec.hpp>
+#include <yas/detail/tools/cast.hpp>
+
+#include <cmath>
+#include <cstring>
+
+namespace yas {
+namespace detail {
+
+/***************************************************************************/
+
+// the codec for the floats and doubles wrapped by 'yas::narrow()' in compacted archives.
+// the value is stored by the smallest lossless of:
+//   the integer: the values with no fraction and the magnitude up to 2^53,
+//                the zigzag-encoded integer is stored inline into the header
+//                when less than 'inline_limit', otherwise 1..7 bytes follows
+//   the float32: the doubles which are exactly representable as float
+//   the float64: the rest, the NaNs included(their payloads are preserved)
+// all the bytes are little-endian.
+struct narrow_codec {
+    enum: std::uint8_t {
+         inline_limit = 0xb8
+        ,int_bytes1   = 0xb8 // ... int_bytes1 + 6 for 7 bytes
+        ,float32      = 0xbf
+        ,float64      = 0xc0
+    };
+    enum: std::size_t { max_size = 1 + 8 };
+
+    template<typename OS, typename T>
+    static void encode(OS &os, const T &v) {
+        std::uint8_t buf[max_size];
+        const std::size_t size = encode(buf, v);
+        __YAS_THROW_WRITE_ERROR(size != os.write(buf, size));
+    }
+
+    template<typename IS, typename T>
+    static void decode(IS &is, T &v) {
+        // the payload sizes and the kinds of the headers above the inline integers
+        static constexpr std::uint8_t sizes[] = {1, 2, 3, 4, 5, 6, 7, 4, 8};
+        enum: std::uint8_t { k_int, k_f32, k_f64 };
+        static constexpr std::uint8_t kinds[] = {k_int, k_int, k_int, k_int, k_int, k_int, k_int, k_f32, k_f64};
+
+        std::uint8_t h = 0;
+        __YAS_THROW_READ_ERROR(1 != is.read(&h, 1));
+        if ( __YAS_LIKELY(h < inline_limit) ) {
+            v = __YAS_SCAST(T, unzigzag(h));
+            return;
+        }
+
+        const std::size_t idx = h - inline_limit;
+        __YAS_THROW_READ_STORAGE_SIZE_ERROR(idx >= sizeof(sizes));
+
+        std::uint8_t buf[8] = {0};
+        const std::size_t size = sizes[idx];
+        __YAS_THROW_READ_ERROR(size != is.read(buf, size));
+        const std::uint64_t u = int_block_codec::load_le64(buf);
+        switch ( kinds[idx] ) {
+            case k_int: {
+                v = __YAS_SCAST(T, unzigzag(u));
+            } break;
+            case k_f32: {
+                const std::uint32_t u32 = __YAS_SCAST(std::uint32_t, u);
+                float f;
+                std::memcpy(&f, &u32, sizeof(f));
+                v = __YAS_SCAST(T, f);
+            } break;
+            default: {
+                double d;
+                std::memcpy(&d, &u, sizeof(d));
+                v = __YAS_SCAST(T, d);
+            }
+        }
+    }
+
+    template<typename T>
+    static std::size_t encode(std::uint8_t *buf, const T &v) {
+        // the comparisons are false for NaN, the infinities are out of range
+        if ( v >= -9007199254740992.0 && v <= 9007199254740992.0 ) {
+            const std::int64_t i = __YAS_SCAST(std::int64_t, v);
+            if ( __YAS_SCAST(T, i) == v && !(i == 0 && std::signbit(v)) ) {
+                const std::uint64_t z = zigzag(i);
+                if ( z < inline_limit ) {
+                    buf[0] = __YAS_SCAST(std::uint8_t, z);
+                    return 1;
+                }
+
+                const std::size_t n = bytes_width(z);
+                buf[0] = __YAS_SCAST(std::uint8_t, int_bytes1 + n - 1);
+                int_block_codec::store_le64(buf + 1, z);
+                return 1 + n;
+            }
+        }
+
+        return encode_float(buf, v);
+    }
+
+private:
+    static std::size_t encode_float(std::uint8_t *buf, const float &v) {
+        std::uint32_t u;
+        std::memcpy(&u, &v, sizeof(u));
+        buf[0] = float32;
+        store_le32(buf + 1, u);
+        return 1 + sizeof(u);
+    }
+    static std::size_t encode_float(std::uint8_t *buf, const double &v) {
+        const float f = __YAS_SCAST(float, v);
+        if ( __YAS_SCAST(double, f) == v ) {
+            return encode_float(buf, f);
+        }
+
+        std::uint64_t u;
+        std::memcpy(&u, &v, sizeof(u));
+        buf[0] = float64;
+        int_block_codec::store_le64(buf + 1, u);
+        return 1 + sizeof(u);
+    }
+
+    static void store_le32(std::uint8_t *p, std::uint32_t v) {
+        for ( std::size_t i = 0; i < 4; ++i, v >>= 8 ) {
+            p[i] = __YAS_SCAST(std::uint8_t, v);
+        }
+    }
+
+    static std::uint64_t zigzag(std::int64_t v) {
+        return (__YAS_SCAST(std::uint64_t, v) << 1) ^ (0 - (__YAS_SCAST(std::uint64_t, v) >> 63));
+    }
+    static std::int64_t unzigzag(std::uint64_t u) {
+        return __YAS_SCAST(std::int64_t, (u >> 1) ^ (0 - (u & 1u)));
+    }
+
+    static std::size_t bytes_width(std::uint64_t v) {
+        std::size_t r = 0;
+        for ( ; v; v >>= 8 ) { ++r; }
+        return r;
+    }
+};
+
+/***************************************************************************/
+
+} // ns detail
+} // ns yas
+
+#endif // __yas__detail__io__narrow_codec_hpp
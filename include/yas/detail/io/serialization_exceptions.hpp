@@ -85,6 +85,15 @@ struct no_json_key_exception: serialization_exception {
 #define __YAS_THROW_BASE64_ERROR(msg) \
     __YAS_THROW_EXCEPTION(::yas::serialization_exception, msg);
 
+#define __YAS_THROW_INVALID_UTF8() \
+    __YAS_THROW_EXCEPTION(::yas::serialization_exception, "invalid UTF-8 sequence");
+
+#define __YAS_THROW_INVALID_NUMBER() \
+    __YAS_THROW_EXCEPTION(::yas::serialization_exception, "invalid or out of range number");
+
+#define __YAS_THROW_BAD_FIXED_POINT_SCALE() \
+    __YAS_THROW_EXCEPTION(::yas::serialization_exception, "fixed point scale is not positive and finite");
+
 /***************************************************************************/
 
 } // ns yas
@@ -36,7 +36,10 @@
 #ifndef __yas__detail__tools__ctmap_hpp
 #define __yas__detail__tools__ctmap_hpp
 
+#include <yas/detail/tools/cast.hpp>
+
 #include <tuple>
+#include <type_traits>
 #include <cstdint>
 
 namespace yas {
@@ -52,12 +55,124 @@ struct pair {
 
 using optional_t = pair<bool, std::uint8_t>;
 
+// The perfect hash of the keys: the slot of a key is the 'bits' bits of its
+// hash starting from the 'shift' bit. The smallest table with no collisions
+// is searched at compile time, up to 256 slots.
+
+template<std::size_t...>
+struct ctmap_seq {};
+
+template<std::size_t N, std::size_t... I>
+struct ctmap_make_seq: ctmap_make_seq<N-1, N-1, I...> {};
+
+template<std::size_t... I>
+struct ctmap_make_seq<0, I...> {
+    using type = ctmap_seq<I...>;
+};
+
+constexpr std::uint32_t ctmap_slot(std::uint32_t h, unsigned shift, std::uint32_t mask) {
+    return (h >> shift) & mask;
+}
+
+constexpr bool ctmap_none_in(std::uint32_t, unsigned, std::uint32_t) { return true; }
+
+template<typename... H>
+constexpr bool ctmap_none_in(std::uint32_t slot, unsigned shift, std::uint32_t mask, std::uint32_t h, H... hs) {
+    return ctmap_slot(h, shift, mask) != slot && ctmap_none_in(slot, shift, mask, hs...);
+}
+
+constexpr bool ctmap_distinct(unsigned, std::uint32_t) { return true; }
+
+template<typename... H>
+constexpr bool ctmap_distinct(unsigned shift, std::uint32_t mask, std::uint32_t h, H... hs) {
+    return ctmap_none_in(ctmap_slot(h, shift, mask), shift, mask, hs...)
+        && ctmap_distinct(shift, mask, hs...);
+}
+
+// (bits << 8 | shift), or zero if there is no perfect hash
+template<typename... H>
+constexpr std::uint32_t ctmap_search(unsigned bits, unsigned shift, H... hs) {
+    return bits > 8
+        ? 0
+        : shift + bits > 32
+            ? ctmap_search(bits + 1, 0, hs...)
+            : ctmap_distinct(shift, (1u << bits) - 1, hs...)
+                ? ((bits << 8) | shift)
+                : ctmap_search(bits, shift + 1, hs...)
+    ;
+}
+
+constexpr unsigned ctmap_min_bits(std::size_t n, unsigned bits = 0) {
+    return (std::size_t(1) << bits) >= 2 * n ? bits : ctmap_min_bits(n, bits + 1);
+}
+
+// the position of the key which occupies the slot, or 0xff
+constexpr std::uint8_t ctmap_position(std::uint32_t, unsigned, std::uint32_t, std::uint8_t) { return 0xff; }
+
+template<typename... H>
+constexpr std::uint8_t ctmap_position(std::uint32_t slot, unsigned shift, std::uint32_t mask, std::uint8_t pos, std::uint32_t h, H... hs) {
+    return ctmap_slot(h, shift, mask) == slot
+        ? pos
+        : ctmap_position(slot, shift, mask, __YAS_SCAST(std::uint8_t, pos + 1), hs...)
+    ;
+}
+
+template<unsigned Shift, std::uint32_t Mask, typename Seq, std::uint32_t... H>
+struct ctmap_slots;
+
+template<unsigned Shift, std::uint32_t Mask, std::size_t... I, std::uint32_t... H>
+struct ctmap_slots<Shift, Mask, ctmap_seq<I...>, H...> {
+    static constexpr std::uint8_t positions[] = {
+        ctmap_position(__YAS_SCAST(std::uint32_t, I), Shift, Mask, 0, H...)...
+    };
+};
+template<unsigned Shift, std::uint32_t Mask, std::size_t... I, std::uint32_t... H>
+constexpr std::uint8_t ctmap_slots<Shift, Mask, ctmap_seq<I...>, H...>::positions[];
+
+template<std::uint32_t... H>
+struct ctmap_perfect_hash {
+    static constexpr std::uint32_t params = ctmap_search(ctmap_min_bits(sizeof...(H)), 0, H...);
+    static constexpr unsigned bits = params >> 8;
+    static constexpr unsigned shift = params & 0xff;
+    static constexpr std::uint32_t mask = (1u << bits) - 1;
+
+    using slots = ctmap_slots<
+         shift
+        ,mask
+        ,typename ctmap_make_seq<(std::size_t(1) << bits)>::type
+        ,H...
+    >;
+};
+
+/***************************************************************************/
+
 template<typename>
 struct ctmap;
 
 template<typename... KVI>
 struct ctmap<std::tuple<KVI...>> {
     optional_t find(std::uint32_t k) const {
+        return find(k, std::integral_constant<bool, (hash::bits != 0)>{});
+    }
+
+    static constexpr pair<std::uint32_t, std::uint8_t> kvis[] = {
+        {KVI::first_type::value, KVI::second_type::value}...
+    };
+
+private:
+    using hash = ctmap_perfect_hash<KVI::first_type::value...>;
+
+    optional_t find(std::uint32_t k, std::true_type) const {
+        const std::uint8_t pos = hash::slots::positions[ctmap_slot(k, hash::shift, hash::mask)];
+        if ( pos == 0xff || kvis[pos].key != k ) {
+            return {false, 0};
+        }
+
+        return {true, kvis[pos].val};
+    }
+
+    // the binary search if the perfect hash is not found
+    optional_t find(std::uint32_t k, std::false_type) const {
         auto beg = &kvis[0];
         auto end = &kvis[sizeof...(KVI)];
         std::size_t count = sizeof...(KVI);
@@ -73,10 +188,6 @@ struct ctmap<std::tuple<KVI...>> {
 
         return {(beg != end && beg->key == k), beg->val};
     }
-
-    static constexpr pair<std::uint32_t, std::uint8_t> kvis[] = {
-        {KVI::first_type::value, KVI::second_type::value}...
-    };
 };
 template<typename... KVI>
 constexpr pair<std::uint32_t, std::uint8_t> ctmap<std::tuple<KVI...>>::kvis[];
@@ -0,0 +1,223 @@
+
+// Copyright (c) 2010-2021 niXman (github dot nixman at pm dot me). All
+// rights reserved.
+//
+// This file is part of YAS(https://github.com/niXman/yas) project.
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//
+//
+// Boost Software License - Version 1.0 - August 17th, 2003
+//
+// Permission is hereby granted, free of charge, to any person or organization
+// obtaining a copy of the software and accompanying documentation covered by
+// this license (the "Software") to use, reproduce, display, distribute,
+// execute, and transmit the Software, and to prepare derivative works of the
+// Software, and to permit third-parties to whom the Software is furnished to
+// do so, all subject to the following:
+//
+// The copyright notices in the Software and this entire statement, including
+// the above license grant, this restriction and the following disclaimer,
+// must be included in all copies of the Software, in whole or in part, and
+// all derivative works of the Software, unless such copies or derivative
+// works are solely in the form of machine-executable object code generated by
+// a source language processor.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+// SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+// FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+
+
+#ifndef __yas__detail__tools__fast_itoa_hpp
+#define __yas__detail__tools__fast_itoa_hpp
+
+#include <yas/detail/tools/cast.hpp>
+#include <yas/detail/tools/fast_atod.hpp>
+
+#include <cstdint>
+#include <cstring>
+
+namespace yas {
+namespace detail {
+
+/***************************************************************************/
+
+// The formatting is by J. Jeaiii: the leading digits of a value below 10^8
+// are taken as a 32-bit fixed-point fraction, and every following pair of
+// the digits is the integer part of the fraction multiplied by 100. So there
+// is only one multiplication per two digits and no divisions at all.
+
+inline const char* itoa_digit_pairs() {
+    static const char lut[200] = {
+        '0','0','0','1','0','2','0','3','0','4','0','5','0','6','0','7','0','8','0','9',
+        '1','0','1','1','1','2','1','3','1','4','1','5','1','6','1','7','1','8','1','9',
+        '2','0','2','1','2','2','2','3','2','4','2','5','2','6','2','7','2','8','2','9',
+        '3','0','3','1','3','2','3','3','3','4','3','5','3','6','3','7','3','8','3','9',
+        '4','0','4','1','4','2','4','3','4','4','4','5','4','6','4','7','4','8','4','9',
+        '5','0','5','1','5','2','5','3','5','4','5','5','5','6','5','7','5','8','5','9',
+        '6','0','6','1','6','2','6','3','6','4','6','5','6','6','6','7','6','8','6','9',
+        '7','0','7','1','7','2','7','3','7','4','7','5','7','6','7','7','7','8','7','9',
+        '8','0','8','1','8','2','8','3','8','4','8','5','8','6','8','7','8','8','8','9',
+        '9','0','9','1','9','2','9','3','9','4','9','5','9','6','9','7','9','8','9','9'
+    };
+
+    return lut;
+}
+
+inline char* itoa_pair(char *p, std::uint64_t f) {
+    std::memcpy(p, itoa_digit_pairs() + (f >> 32) * 2, 2);
+
+    return p + 2;
+}
+
+inline char* itoa_next_pairs(char *p, std::uint64_t f, int pairs) {
+    for ( ; pairs; --pairs ) {
+        f = (f & 0xffffffffu) * 100;
+        p = itoa_pair(p, f);
+    }
+
+    return p;
+}
+
+// the leading digit is alone if the number of the digits is odd
+inline char* itoa_leading(char *p, std::uint64_t f, bool odd) {
+    if ( odd ) {
+        *p = __YAS_SCAST(char, '0' + (f >> 32));
+
+        return p + 1;
+    }
+
+    return itoa_pair(p, f);
+}
+
+// v / 10^6 as 32.32 fixed-point, rounded up so the zero pairs survive
+inline std::uint64_t itoa_fraction_1e6(std::uint32_t v) {
+    // ceil(2^48 / 10^6) + 1
+    return ((std::uint64_t(v) * 281474978u) >> 16) + 1;
+}
+
+// v < 10^8, without the leading zeros
+inline char* itoa_below_1e8(char *p, std::uint32_t v) {
+    if ( v < 100 ) {
+        if ( v < 10 ) {
+            *p = __YAS_SCAST(char, '0' + v);
+
+            return p + 1;
+        }
+        std::memcpy(p, itoa_digit_pairs() + v * 2, 2);
+
+        return p + 2;
+    }
+    if ( v < 10000 ) {
+        // ceil(2^32 / 10^2)
+        const std::uint64_t f = std::uint64_t(v) * 42949673u;
+        p = itoa_leading(p, f, v < 1000);
+
+        return itoa_next_pairs(p, f, 1);
+    }
+    if ( v < 1000000 ) {
+        // ceil(2^32 / 10^4)
+        const std::uint64_t f = std::uint64_t(v) * 429497u;
+        p = itoa_leading(p, f, v < 100000);
+
+        return itoa_next_pairs(p, f, 2);
+    }
+
+    const std::uint64_t f = itoa_fraction_1e6(v);
+    p = itoa_leading(p, f, v < 10000000);
+
+    return itoa_next_pairs(p, f, 3);
+}
+
+// exactly eight digits, v < 10^8
+inline char* itoa_eight(char *p, std::uint32_t v) {
+    const std::uint64_t f = itoa_fraction_1e6(v);
+    p = itoa_pair(p, f);
+
+    return itoa_next_pairs(p, f, 3);
+}
+
+// returns the end of the written digits
+inline char* fast_utoa(char *p, std::uint64_t v) {
+    if ( v < 100000000u ) {
+        return itoa_below_1e8(p, __YAS_SCAST(std::uint32_t, v));
+    }
+    if ( v < 10000000000000000ull ) {
+        p = itoa_below_1e8(p, __YAS_SCAST(std::uint32_t, v / 100000000u));
+
+        return itoa_eight(p, __YAS_SCAST(std::uint32_t, v % 100000000u));
+    }
+
+    const std::uint64_t hi = v / 100000000u;
+    p = itoa_below_1e8(p, __YAS_SCAST(std::uint32_t, hi / 100000000u));
+    p = itoa_eight(p, __YAS_SCAST(std::uint32_t, hi % 100000000u));
+
+    return itoa_eight(p, __YAS_SCAST(std::uint32_t, v % 100000000u));
+}
+
+inline char* fast_itoa(char *p, std::int64_t v) {
+    std::uint64_t u = __YAS_SCAST(std::uint64_t, v);
+    if ( v < 0 ) {
+        *p++ = '-';
+        u = 0 - u;
+    }
+
+    return fast_utoa(p, u);
+}
+
+/***************************************************************************/
+
+// Eight digits at a time by the SWAR of fast_atod.hpp. The leading zeros are
+// allowed. Returns false if any char is not a digit or if the value does not
+// fit into 64 bits.
+inline bool fast_atou(const char *p, std::size_t size, std::uint64_t &v) {
+    if ( !size ) {
+        return false;
+    }
+
+    const char *end = p + size;
+    for ( ; end - p > 1 && *p == '0'; ++p )
+        ;
+    if ( end - p > 20 ) {
+        return false;
+    }
+
+    // the first 19 digits never overflow, the 20th one is checked
+    const char *stop = (end - p == 20) ? end - 1 : end;
+    std::uint64_t r = 0;
+    for ( ; stop - p >= 8; p += 8 ) {
+        const std::uint64_t chunk = atod_load8(p);
+        if ( !atod_is_eight_digits(chunk) ) {
+            return false;
+        }
+        r = r * 100000000u + atod_eight_digits(chunk);
+    }
+    for ( ; p != end; ++p ) {
+        const unsigned d = __YAS_SCAST(unsigned char, *p) - unsigned('0');
+        if ( d > 9 ) {
+            return false;
+        }
+        // 18446744073709551615
+        if ( p == stop && (r > 1844674407370955161ull || (r == 1844674407370955161ull && d > 5)) ) {
+            return false;
+        }
+        r = r * 10 + d;
+    }
+
+    v = r;
+
+    return true;
+}
+
+/***************************************************************************/
+
+} // ns detail
+} // ns yas
+
+#endif // __yas__detail__tools__fast_itoa_hpp
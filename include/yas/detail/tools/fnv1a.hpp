@@ -77,6 +77,19 @@ constexpr std::uint32_t fnv1a(const CharT *s, std::uint32_t h = 0x811c9dc5) {
 
 #endif // __cplusplus >= 201402L
 
+// the same hash of the chars which are not zero-terminated
+inline std::uint32_t fnv1a_range(const char *beg, const char *end) {
+    std::uint32_t seed = 0x811c9dc5;
+    for ( ; beg != end; ++beg ) {
+        seed = __YAS_SCAST(
+             std::uint32_t
+            ,((seed ^ __YAS_SCAST(std::uint32_t, *beg)) * __YAS_SCAST(std::uint64_t, 0x01000193))
+        );
+    }
+
+    return seed;
+}
+
 /***************************************************************************/
 
 } // ns detail
@@ -0,0 +1,289 @@
+
+// Copyright (c) 2010-2021 niXman (github dot nixman at pm dot me). All
+// rights reserved.
+//
+// This file is part of YAS(https://github.com/niXman/yas) project.
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//
+//
+// Boost Software License - Version 1.0 - August 17th, 2003
+//
+// Permission is hereby granted, free of charge, to any person or organization
+// obtaining a copy of the software and accompanying documentation covered by
+// this license (the "Software") to use, reproduce, display, distribute,
+// execute, and transmit the Software, and to prepare derivative works of the
+// Software, and to permit third-parties to whom the Software is furnished to
+// do so, all subject to the following:
+//
+// The copyright notices in the Software and this entire statement, including
+// the above license grant, this restriction and the following disclaimer,
+// must be included in all copies of the Software, in whole or in part, and
+// all derivative works of the Software, unless such copies or derivative
+// works are solely in the form of machine-executable object code generated by
+// a source language processor.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+// SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+// FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+
+
+#ifndef __yas__detail__tools__json_index_hpp
+#define __yas__detail__tools__json_index_hpp
+
+#include <yas/detail/config/config.hpp>
+#include <yas/detail/tools/cast.hpp>
+
+#include <algorithm>
+#include <vector>
+#include <cstring>
+#include <cstdint>
+
+#if defined(__YAS_SSE2)
+#   include <immintrin.h>
+#endif
+#if defined(_MSC_VER) && !defined(__clang__)
+#   include <intrin.h>
+#endif
+
+namespace yas {
+namespace detail {
+
+/***************************************************************************/
+
+// The structural index of a contiguous JSON input, as the stage one of
+// simdjson: every 64 bytes are classified at once into the bitmasks of the
+// quotes, the backslashes and the brackets, the escaped quotes and the bytes
+// inside of the strings are masked out by the carry-less arithmetic, and the
+// remaining brackets are matched by a stack. For every object and array the
+// index holds the position past its end, so the skipping of an unknown value
+// is a jump. The strings are not indexed, json_string_end() finds the closing
+// quote faster than the index would be searched.
+//
+// The index is built lazily from the first value which is skipped, and only
+// as far as it is needed to find the end of the value being skipped.
+
+struct json_index_masks {
+    std::uint64_t quote;
+    std::uint64_t backslash;
+    std::uint64_t open;  // '{' and '['
+    std::uint64_t close; // '}' and ']'
+};
+
+inline std::size_t json_index_ctz(std::uint64_t v) {
+#if defined(_MSC_VER) && !defined(__clang__) && defined(_M_X64)
+    unsigned long idx;
+    _BitScanForward64(&idx, v);
+    return idx;
+#elif defined(_MSC_VER) && !defined(__clang__)
+    std::size_t n = 0;
+    for ( ; !(v & 1); v >>= 1 ) {
+        ++n;
+    }
+    return n;
+#else
+    return __YAS_SCAST(std::size_t, __builtin_ctzll(v));
+#endif
+}
+
+// the running xor of the bits: the bit i is the parity of the bits 0..i
+inline std::uint64_t json_index_prefix_xor(std::uint64_t v) {
+    v ^= v << 1;
+    v ^= v << 2;
+    v ^= v << 4;
+    v ^= v << 8;
+    v ^= v << 16;
+    v ^= v << 32;
+
+    return v;
+}
+
+// the '[' and the ']' differ from the '{' and the '}' by the 0x20 bit only
+inline json_index_masks json_index_classify(const char *p) {
+    json_index_masks m;
+#if defined(__YAS_SSE2)
+    const __m128i quote = _mm_set1_epi8('"');
+    const __m128i backslash = _mm_set1_epi8('\\');
+    const __m128i open = _mm_set1_epi8('{');
+    const __m128i close = _mm_set1_epi8('}');
+    const __m128i lower = _mm_set1_epi8(0x20);
+    m.quote = m.backslash = m.open = m.close = 0;
+    for ( int i = 0; i < 4; ++i ) {
+        const __m128i v = _mm_loadu_si128(__YAS_RCAST(const __m128i *, p + i * 16));
+        const __m128i l = _mm_or_si128(v, lower);
+        const int shift = i * 16;
+        m.quote |= std::uint64_t(std::uint16_t(_mm_movemask_epi8(_mm_cmpeq_epi8(v, quote)))) << shift;
+        m.backslash |= std::uint64_t(std::uint16_t(_mm_movemask_epi8(_mm_cmpeq_epi8(v, backslash)))) << shift;
+        m.open |= std::uint64_t(std::uint16_t(_mm_movemask_epi8(_mm_cmpeq_epi8(l, open)))) << shift;
+        m.close |= std::uint64_t(std::uint16_t(_mm_movemask_epi8(_mm_cmpeq_epi8(l, close)))) << shift;
+    }
+#else
+    m.quote = m.backslash = m.open = m.close = 0;
+    for ( int i = 0; i < 64; ++i ) {
+        const char ch = p[i];
+        const std::uint64_t bit = std::uint64_t(1) << i;
+        m.quote |= (ch == '"') ? bit : 0;
+        m.backslash |= (ch == '\\') ? bit : 0;
+        m.open |= ((ch | 0x20) == '{') ? bit : 0;
+        m.close |= ((ch | 0x20) == '}') ? bit : 0;
+    }
+#endif // __YAS_SSE2
+
+    return m;
+}
+
+// the end of the string which starts at 'p' by the opening quote, or nullptr
+inline const char* json_string_end(const char *p, const char *last) {
+    ++p;
+    while ( true ) {
+#if defined(__YAS_SSE2)
+        const __m128i quote = _mm_set1_epi8('"');
+        const __m128i backslash = _mm_set1_epi8('\\');
+        for ( ; last - p >= 16; p += 16 ) {
+            const __m128i v = _mm_loadu_si128(__YAS_RCAST(const __m128i *, p));
+            const unsigned mask = __YAS_SCAST(unsigned, _mm_movemask_epi8(
+                _mm_or_si128(_mm_cmpeq_epi8(v, quote), _mm_cmpeq_epi8(v, backslash))
+            ));
+            if ( mask ) {
+                p += json_index_ctz(mask);
+                break;
+            }
+        }
+#endif // __YAS_SSE2
+        for ( ; p != last && *p != '"' && *p != '\\'; ++p )
+            ;
+        if ( p == last ) {
+            return nullptr;
+        }
+        if ( *p == '"' ) {
+            return p + 1;
+        }
+        // the escaped char
+        if ( last - p < 2 ) {
+            return nullptr;
+        }
+        p += 2;
+    }
+}
+
+struct json_structural_index {
+    json_structural_index()
+        :base(nullptr)
+        ,size(0)
+        ,indexed(0)
+        ,prev_escaped(0)
+        ,prev_in_string(0)
+        ,next(0)
+        ,pos()
+        ,end()
+        ,stack()
+    {}
+
+    // the end of the object or the array which starts at 'cur', or nullptr
+    // if it is not found (the malformed input)
+    const char* value_end(const char *cur, const char *last) {
+        if ( !base ) {
+            // the input is not expected to be that large, but the positions are 32-bit
+            if ( __YAS_SCAST(std::uint64_t, last - cur) > 0xffffffffu ) {
+                return nullptr;
+            }
+            base = cur;
+            size = __YAS_SCAST(std::size_t, last - cur);
+        }
+        if ( cur < base || cur >= base + size ) {
+            return nullptr;
+        }
+
+        const std::uint32_t off = __YAS_SCAST(std::uint32_t, cur - base);
+        while ( indexed <= off && indexed < size ) {
+            index_block();
+        }
+
+        // the reader goes forward only, so the search starts from the last found
+        if ( next > pos.size() || (next && pos[next-1] >= off) ) {
+            next = 0;
+        }
+        next = __YAS_SCAST(std::size_t, std::lower_bound(pos.begin() + next, pos.end(), off) - pos.begin());
+        if ( next == pos.size() || pos[next] != off ) {
+            return nullptr;
+        }
+
+        while ( !end[next] && indexed < size ) {
+            index_block();
+        }
+
+        return end[next] ? base + end[next] : nullptr;
+    }
+
+private:
+    void index_block() {
+        char tail[64];
+        const char *p = base + indexed;
+        const std::size_t n = (std::min)(size - indexed, sizeof(tail));
+        if ( n < sizeof(tail) ) {
+            std::memset(tail, ' ', sizeof(tail));
+            std::memcpy(tail, p, n);
+            p = tail;
+        }
+
+        const json_index_masks m = json_index_classify(p);
+
+        // the quotes preceded by an odd number of the backslashes are escaped
+        const std::uint64_t even_bits = 0x5555555555555555ull;
+        const std::uint64_t backslash = m.backslash & ~prev_escaped;
+        const std::uint64_t follows_escape = (backslash << 1) | prev_escaped;
+        const std::uint64_t odd_starts = backslash & ~even_bits & ~follows_escape;
+        const std::uint64_t even_sequences = odd_starts + backslash;
+        prev_escaped = (even_sequences < odd_starts) ? 1 : 0;
+        const std::uint64_t escaped = (even_bits ^ (even_sequences << 1)) & follows_escape;
+
+        const std::uint64_t quote = m.quote & ~escaped;
+        const std::uint64_t in_string = json_index_prefix_xor(quote) ^ prev_in_string;
+        prev_in_string = __YAS_SCAST(std::uint64_t, -__YAS_SCAST(std::int64_t, in_string >> 63));
+
+        std::uint64_t bits = (m.open | m.close) & ~in_string;
+        for ( ; bits; bits &= bits - 1 ) {
+            const std::size_t i = json_index_ctz(bits);
+            const std::uint32_t at = __YAS_SCAST(std::uint32_t, indexed + i);
+            const std::uint64_t bit = std::uint64_t(1) << i;
+            if ( m.open & bit ) {
+                stack.push_back(pos.size());
+                pos.push_back(at);
+                end.push_back(0);
+            } else if ( !stack.empty() ) {
+                // the closings of the values enclosing the first one are not indexed
+                const std::size_t idx = stack.back();
+                stack.pop_back();
+                // '{' + 2 == '}' and '[' + 2 == ']'
+                if ( base[pos[idx]] + 2 == base[at] ) {
+                    end[idx] = at + 1;
+                }
+            }
+        }
+
+        indexed += n;
+    }
+
+    const char *base;
+    std::size_t size;
+    std::size_t indexed;
+    std::uint64_t prev_escaped;
+    std::uint64_t prev_in_string;
+    std::size_t next;
+    std::vector<std::uint32_t> pos;
+    std::vector<std::uint32_t> end;
+    std::vector<std::size_t> stack;
+};
+
+/***************************************************************************/
+
+} // ns detail
+} // ns yas
+
+#endif // __yas__detail__tools__json_index_hpp
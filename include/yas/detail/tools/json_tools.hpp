@@ -37,8 +37,10 @@
 #define __yas__detail__tools__json_tools_hpp
 
 #include <yas/detail/io/serialization_exceptions.hpp>
+#include <yas/detail/type_traits/flags.hpp>
 
 #include <cstdint>
+#include <type_traits>
 
 namespace yas {
 namespace detail {
@@ -149,8 +151,8 @@ void json_skip_string(Archive &ar) {
                     case 'f' :
                     case 'n' :
                     case 'r' :
-                    case 't' : return;
-                    case 'u' : return json_skip_unicode(ar);
+                    case 't' : continue;
+                    case 'u' : { json_skip_unicode(ar); continue; }
                     default: __YAS_THROW_INVALID_JSON_STRING("invalid string: forbidden char")
                 }
             }
@@ -163,6 +165,13 @@ void json_skip_string(Archive &ar) {
 
 template<typename Archive>
 void json_skip_array(Archive &ar) {
+    json_skipws(ar);
+    if ( ar.peekch() == ']' ) {
+        ar.getch();
+
+        return;
+    }
+
     while ( true ) {
         json_skipws(ar);
         json_skip_val(ar);
@@ -177,6 +186,13 @@ void json_skip_array(Archive &ar) {
 
 template<typename Archive>
 void json_skip_object(Archive &ar) {
+    json_skipws(ar);
+    if ( ar.peekch() == '}' ) {
+        ar.getch();
+
+        return;
+    }
+
     while ( true ) {
         json_skipws(ar);
         __YAS_THROW_IF_WRONG_JSON_CHARS(ar, "\"")
@@ -197,8 +213,19 @@ void json_skip_object(Archive &ar) {
 
 /***************************************************************************/
 
+// the loaders are instantiated for all of the archives
+template<typename Archive>
+bool json_skip_indexed(Archive &ar, std::true_type) { return ar.skip_value(); }
+template<typename Archive>
+bool json_skip_indexed(Archive &, std::false_type) { return false; }
+
 template<typename Archive>
 void json_skip_val(Archive &ar) {
+    // a jump on the contiguous input
+    if ( json_skip_indexed(ar, std::integral_constant<bool, (Archive::flags() & yas::json) != 0>{}) ) {
+        return;
+    }
+
     const char ch = ar.getch();
     switch ( ch ) {
         case '\"': { json_skip_string(ar); break; }
@@ -227,7 +254,8 @@ void json_skip_val(Archive &ar) {
 template<typename Archive>
 std::size_t json_read_key(Archive &ar, char *ptr, std::size_t size) {
     const char *p = ptr;
-    while ( size-- ) {
+    // the room for the terminating zero
+    for ( ; size > 1; --size ) {
         *ptr = ar.getch();
         if ( *ptr == '\"' ) {
             ar.ungetch(*ptr);
@@ -242,6 +270,24 @@ std::size_t json_read_key(Archive &ar, char *ptr, std::size_t size) {
     return ptr-p;
 }
 
+// the key is read in place if the input is contiguous, 'p' points to it then
+template<typename Archive>
+std::size_t json_read_key(Archive &ar, char *buf, std::size_t size, const char *&p, std::true_type) {
+    return ar.read_key(buf, size, p);
+}
+
+template<typename Archive>
+std::size_t json_read_key(Archive &ar, char *buf, std::size_t size, const char *&p, std::false_type) {
+    p = buf;
+
+    return json_read_key(ar, buf, size);
+}
+
+template<typename Archive>
+std::size_t json_read_key(Archive &ar, char *buf, std::size_t size, const char *&p) {
+    return json_read_key(ar, buf, size, p, std::integral_constant<bool, (Archive::flags() & yas::json) != 0>{});
+}
+
 /***************************************************************************/
 
 template<typename Archive>
@@ -265,6 +311,15 @@ bool is_valid_for_int_and_double(Archive &, char ch) {
     }
 }
 
+// the length of the leading run of the chars of an integer
+inline std::size_t json_num_run(const char *p, std::size_t size) {
+    std::size_t n = 0;
+    for ( ; n < size && ((p[n] >= '0' && p[n] <= '9') || p[n] == '-'); ++n )
+        ;
+
+    return n;
+}
+
 template<typename Archive>
 std::size_t json_read_num(Archive &ar, char *ptr, std::size_t size) {
     char *p = ptr;
@@ -310,6 +365,7 @@ std::size_t json_read_double(Archive &ar, char *ptr, std::size_t size) {
             case '8':
             case '9':
             case '-':
+            case '+':
             case '.':
             case 'e':
             case 'E': break;
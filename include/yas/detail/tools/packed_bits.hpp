@@ -0,0 +1,139 @@
+
+// Copyright (c) 2010-2021 niXman (github dot nixman at pm dot me). All
+// rights reserved.
+//
+// This file is part of YAS(https://github.com/niXman/yas) project.
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//
+//
+// Boost Software License - Version 1.0 - August 17th, 2003
+//
+// Permission is hereby granted, free of charge, to any person or organization
+// obtaining a copy of the software and accompanying documentation covered by
+// this license (the "Software") to use, reproduce, display, distribute,
+// execute, and transmit the Software, and to prepare derivative works of the
+// Software, and to permit third-parties to whom the Software is furnished to
+// do so, all subject to the following:
+//
+// The copyright notices in the Software and this entire statement, including
+// the above license grant, this restriction and the following disclaimer,
+// must be included in all copies of the Software, in whole or in part, and
+// all derivative works of the Software, unless such copies or derivative
+// works are solely in the form of machine-executable object code generated by
+// a source language processor.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+// SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+// FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+
+
+#ifndef __yas__detail__tools__packed_bits_hpp
+#define __yas__detail__tools__packed_bits_hpp
+
+#include <yas/detail/config/config.hpp>
+#include <yas/detail/tools/cast.hpp>
+#include <yas/detail/io/int_block_codec.hpp>
+
+namespace yas {
+namespace detail {
+
+/***************************************************************************/
+
+// the bits are stored LSB-first: the bit 'i' is the bit 'i%8' of the byte 'i/8'.
+// the containers are processed by the chunks of 'packed_bits_chunk' bytes.
+enum: std::size_t { packed_bits_chunk = 4096 };
+
+// 64 bits per step, for any container with 'operator[]'
+template<typename C>
+void pack_bits(std::uint8_t *dst, const C &c, std::size_t pos, std::size_t size) {
+    std::size_t i = 0;
+    for ( ; i + 64 <= size; i += 64, dst += 8 ) {
+        std::uint64_t w = 0;
+        for ( std::size_t j = 0; j < 64; ++j ) {
+            w |= __YAS_SCAST(std::uint64_t, c[pos + i + j] ? 1u : 0u) << j;
+        }
+        int_block_codec::store_le64(dst, w);
+    }
+    if ( i < size ) {
+        std::uint64_t w = 0;
+        for ( std::size_t j = 0; i + j < size; ++j ) {
+            w |= __YAS_SCAST(std::uint64_t, c[pos + i + j] ? 1u : 0u) << j;
+        }
+        for ( std::size_t j = 0; j < (size - i + 7) / 8; ++j, w >>= 8 ) {
+            dst[j] = __YAS_SCAST(std::uint8_t, w);
+        }
+    }
+}
+
+template<typename C>
+void unpack_bits(C &c, std::size_t pos, const std::uint8_t *src, std::size_t size) {
+    std::size_t i = 0;
+    for ( ; i + 64 <= size; i += 64, src += 8 ) {
+        const std::uint64_t w = int_block_codec::load_le64(src);
+        for ( std::size_t j = 0; j < 64; ++j ) {
+            c[pos + i + j] = ((w >> j) & 1u) != 0;
+        }
+    }
+    for ( std::size_t j = 0; i + j < size; ++j ) {
+        c[pos + i + j] = ((src[j / 8] >> (j % 8)) & 1u) != 0;
+    }
+}
+
+template<typename Archive, typename C>
+void save_packed_bits(Archive &ar, const C &c, std::size_t size) {
+    std::uint8_t buf[packed_bits_chunk];
+    for ( std::size_t pos = 0; pos < size; pos += packed_bits_chunk * 8 ) {
+        const std::size_t n = (size - pos < packed_bits_chunk * 8) ? size - pos : packed_bits_chunk * 8;
+        pack_bits(buf, c, pos, n);
+        ar.write(buf, (n + 7) / 8);
+    }
+}
+
+template<typename Archive, typename C>
+void load_packed_bits(Archive &ar, C &c, std::size_t size) {
+    std::uint8_t buf[packed_bits_chunk];
+    for ( std::size_t pos = 0; pos < size; pos += packed_bits_chunk * 8 ) {
+        const std::size_t n = (size - pos < packed_bits_chunk * 8) ? size - pos : packed_bits_chunk * 8;
+        ar.read(buf, (n + 7) / 8);
+        unpack_bits(c, pos, buf, n);
+    }
+}
+
+// one byte per element, the layout of the element-wise bools
+template<typename Archive, typename C>
+void save_bool_bytes(Archive &ar, const C &c, std::size_t size) {
+    std::uint8_t buf[packed_bits_chunk];
+    for ( std::size_t pos = 0; pos < size; pos += packed_bits_chunk ) {
+        const std::size_t n = (size - pos < packed_bits_chunk) ? size - pos : packed_bits_chunk;
+        for ( std::size_t i = 0; i < n; ++i ) {
+            buf[i] = __YAS_SCAST(std::uint8_t, c[pos + i] ? 1u : 0u);
+        }
+        ar.write(buf, n);
+    }
+}
+
+template<typename Archive, typename C>
+void load_bool_bytes(Archive &ar, C &c, std::size_t size) {
+    std::uint8_t buf[packed_bits_chunk];
+    for ( std::size_t pos = 0; pos < size; pos += packed_bits_chunk ) {
+        const std::size_t n = (size - pos < packed_bits_chunk) ? size - pos : packed_bits_chunk;
+        ar.read(buf, n);
+        for ( std::size_t i = 0; i < n; ++i ) {
+            c[pos + i] = buf[i] != 0;
+        }
+    }
+}
+
+/***************************************************************************/
+
+} // ns detail
+} // ns yas
+
+#endif // __yas__detail__tools__packed_bits_hpp
@@ -0,0 +1,268 @@
+
+// Copyright (c) 2010-2021 niXman (github dot nixman at pm dot me). All
+// rights reserved.
+//
+// This file is part of YAS(https://github.com/niXman/yas) project.
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//
+//
+// Boost Software License - Version 1.0 - August 17th, 2003
+//
+// Permission is hereby granted, free of charge, to any person or organization
+// obtaining a copy of the software and accompanying documentation covered by
+// this license (the "Software") to use, reproduce, display, distribute,
+// execute, and transmit the Software, and to prepare derivative works of the
+// Software, and to permit third-parties to whom the Software is furnished to
+// do so, all subject to the following:
+//
+// The copyright notices in the Software and this entire statement, including
+// the above license grant, this restriction and the following disclaimer,
+// must be included in all copies of the Software, in whole or in part, and
+// all derivative works of the Software, unless such copies or derivative
+// works are solely in the form of machine-executable object code generated by
+// a source language processor.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+// SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+// FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+
+
+#ifndef __yas__detail__tools__quantize_hpp
+#define __yas__detail__tools__quantize_hpp
+
+#include <yas/detail/config/config.hpp>
+#include <yas/detail/tools/cast.hpp>
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#if defined(__YAS_AVX2) || defined(__YAS_F16C)
+#   include <immintrin.h>
+#endif
+
+namespace yas {
+namespace detail {
+
+/***************************************************************************/
+
+// the array kernels of 'yas::quantize()' and 'yas::fixed_point()'.
+// the values are rounded to nearest-even, the SIMD and the scalar kernels
+// gives the same results except for the NaN payloads.
+struct quantizer {
+    // IEEE 754 binary16
+    static void to_f16(std::uint16_t *dst, const float *src, std::size_t size) {
+        std::size_t i = 0;
+#if defined(__YAS_F16C)
+        for ( ; i + 8 <= size; i += 8 ) {
+            const __m256 v = _mm256_loadu_ps(src + i);
+            _mm_storeu_si128(__YAS_RCAST(__m128i *, dst + i), _mm256_cvtps_ph(v, _MM_FROUND_TO_NEAREST_INT));
+        }
+#endif
+        for ( ; i < size; ++i ) {
+            dst[i] = to_f16(src[i]);
+        }
+    }
+    static void from_f16(float *dst, const std::uint16_t *src, std::size_t size) {
+        std::size_t i = 0;
+#if defined(__YAS_F16C)
+        for ( ; i + 8 <= size; i += 8 ) {
+            const __m128i v = _mm_loadu_si128(__YAS_RCAST(const __m128i *, src + i));
+            _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(v));
+        }
+#endif
+        for ( ; i < size; ++i ) {
+            dst[i] = from_f16(src[i]);
+        }
+    }
+
+    // the upper half of IEEE 754 binary32
+    static void to_bf16(std::uint16_t *dst, const float *src, std::size_t size) {
+        std::size_t i = 0;
+#if defined(__YAS_AVX2)
+        const __m256i one = _mm256_set1_epi32(1);
+        const __m256i bias = _mm256_set1_epi32(0x7fff);
+        const __m256i quiet = _mm256_set1_epi32(0x400000);
+        for ( ; i + 16 <= size; i += 16 ) {
+            __m256i r[2];
+            for ( std::size_t j = 0; j < 2; ++j ) {
+                const __m256 f = _mm256_loadu_ps(src + i + j * 8);
+                const __m256i u = _mm256_castps_si256(f);
+                const __m256i lsb = _mm256_and_si256(_mm256_srli_epi32(u, 16), one);
+                const __m256i rounded = _mm256_add_epi32(u, _mm256_add_epi32(bias, lsb));
+                const __m256i nan = _mm256_castps_si256(_mm256_cmp_ps(f, f, _CMP_UNORD_Q));
+                const __m256i v = _mm256_blendv_epi8(rounded, _mm256_or_si256(u, quiet), nan);
+                r[j] = _mm256_srli_epi32(v, 16);
+            }
+            // the packing works within the 128-bit lanes
+            const __m256i p = _mm256_permute4x64_epi64(_mm256_packus_epi32(r[0], r[1]), 0xd8);
+            _mm256_storeu_si256(__YAS_RCAST(__m256i *, dst + i), p);
+        }
+#endif
+        for ( ; i < size; ++i ) {
+            dst[i] = to_bf16(src[i]);
+        }
+    }
+    static void from_bf16(float *dst, const std::uint16_t *src, std::size_t size) {
+        std::size_t i = 0;
+#if defined(__YAS_AVX2)
+        for ( ; i + 8 <= size; i += 8 ) {
+            const __m256i v = _mm256_cvtepu16_epi32(_mm_loadu_si128(__YAS_RCAST(const __m128i *, src + i)));
+            _mm256_storeu_si256(__YAS_RCAST(__m256i *, dst + i), _mm256_slli_epi32(v, 16));
+        }
+#endif
+        for ( ; i < size; ++i ) {
+            dst[i] = from_bf16(src[i]);
+        }
+    }
+
+    // the values are multiplied by the scale, the out of range values are
+    // saturated, the NaNs are mapped to the minimum
+    template<typename T>
+    static void to_fixed(std::int32_t *dst, const T *src, std::size_t size, double scale) {
+        std::size_t i = 0;
+#if defined(__YAS_AVX2)
+        i = to_fixed_simd(dst, src, size, scale);
+#endif
+        for ( ; i < size; ++i ) {
+            dst[i] = to_fixed(__YAS_SCAST(double, src[i]) * scale);
+        }
+    }
+    template<typename T>
+    static void from_fixed(T *dst, const std::int32_t *src, std::size_t size, double scale) {
+        std::size_t i = 0;
+#if defined(__YAS_AVX2)
+        i = from_fixed_simd(dst, src, size, scale);
+#endif
+        for ( ; i < size; ++i ) {
+            dst[i] = __YAS_SCAST(T, src[i] / scale);
+        }
+    }
+
+    static std::uint16_t to_f16(float v) {
+        std::uint32_t u = bits_of(v);
+        const std::uint16_t sign = __YAS_SCAST(std::uint16_t, (u >> 16) & 0x8000u);
+        u &= 0x7fffffffu;
+
+        // the infinities, the NaNs and the overflows
+        if ( u >= 0x47800000u ) {
+            return __YAS_SCAST(std::uint16_t, sign | ((u > 0x7f800000u) ? 0x7e00u : 0x7c00u));
+        }
+        // the subnormals, rounded by the addition of 0.5f
+        if ( u < 0x38800000u ) {
+            const std::uint32_t r = bits_of(float_of(u) + 0.5f);
+            return __YAS_SCAST(std::uint16_t, sign | (r - 0x3f000000u));
+        }
+        // the exponent is rebiased from 127 to 15
+        u += 0xc8000fffu + ((u >> 13) & 1u);
+        return __YAS_SCAST(std::uint16_t, sign | (u >> 13));
+    }
+    static float from_f16(std::uint16_t h) {
+        const std::uint32_t sign = __YAS_SCAST(std::uint32_t, h & 0x8000u) << 16;
+        const std::uint32_t em = h & 0x7fffu;
+        if ( em >= 0x7c00u ) {
+            return float_of(sign | 0x7f800000u | ((em & 0x3ffu) << 13));
+        }
+        if ( em >= 0x400u ) {
+            return float_of(sign | ((em << 13) + (112u << 23)));
+        }
+        // the subnormals, exactly
+        return float_of(sign | bits_of(__YAS_SCAST(float, em) * 5.9604644775390625e-8f));
+    }
+
+    static std::uint16_t to_bf16(float v) {
+        const std::uint32_t u = bits_of(v);
+        if ( v != v ) {
+            return __YAS_SCAST(std::uint16_t, (u | 0x400000u) >> 16);
+        }
+        return __YAS_SCAST(std::uint16_t, (u + 0x7fffu + ((u >> 16) & 1u)) >> 16);
+    }
+    static float from_bf16(std::uint16_t h) {
+        return float_of(__YAS_SCAST(std::uint32_t, h) << 16);
+    }
+
+    static std::int32_t to_fixed(double v) {
+        if ( v >= 2147483647.0 ) {
+            return (std::numeric_limits<std::int32_t>::max)();
+        }
+        if ( !(v > -2147483648.0) ) {
+            return (std::numeric_limits<std::int32_t>::min)();
+        }
+        return __YAS_SCAST(std::int32_t, std::nearbyint(v));
+    }
+
+private:
+    static std::uint32_t bits_of(float v) {
+        std::uint32_t u;
+        std::memcpy(&u, &v, sizeof(u));
+        return u;
+    }
+    static float float_of(std::uint32_t u) {
+        float v;
+        std::memcpy(&v, &u, sizeof(v));
+        return v;
+    }
+
+#if defined(__YAS_AVX2)
+    // by four values, in double precision as the scalar kernel
+    static __m128i to_fixed4(__m256d v, __m256d scale) {
+        const __m256d lo = _mm256_set1_pd(-2147483648.0);
+        const __m256d hi = _mm256_set1_pd(2147483647.0);
+        // the NaNs are selected by the 'max' from the second operand
+        const __m256d x = _mm256_min_pd(_mm256_max_pd(_mm256_mul_pd(v, scale), lo), hi);
+        return _mm256_cvtpd_epi32(x);
+    }
+
+    static std::size_t to_fixed_simd(std::int32_t *dst, const float *src, std::size_t size, double scale) {
+        const __m256d s = _mm256_set1_pd(scale);
+        std::size_t i = 0;
+        for ( ; i + 4 <= size; i += 4 ) {
+            const __m256d v = _mm256_cvtps_pd(_mm_loadu_ps(src + i));
+            _mm_storeu_si128(__YAS_RCAST(__m128i *, dst + i), to_fixed4(v, s));
+        }
+        return i;
+    }
+    static std::size_t to_fixed_simd(std::int32_t *dst, const double *src, std::size_t size, double scale) {
+        const __m256d s = _mm256_set1_pd(scale);
+        std::size_t i = 0;
+        for ( ; i + 4 <= size; i += 4 ) {
+            const __m256d v = _mm256_loadu_pd(src + i);
+            _mm_storeu_si128(__YAS_RCAST(__m128i *, dst + i), to_fixed4(v, s));
+        }
+        return i;
+    }
+
+    static std::size_t from_fixed_simd(float *dst, const std::int32_t *src, std::size_t size, double scale) {
+        const __m256d s = _mm256_set1_pd(scale);
+        std::size_t i = 0;
+        for ( ; i + 4 <= size; i += 4 ) {
+            const __m256d v = _mm256_cvtepi32_pd(_mm_loadu_si128(__YAS_RCAST(const __m128i *, src + i)));
+            _mm_storeu_ps(dst + i, _mm256_cvtpd_ps(_mm256_div_pd(v, s)));
+        }
+        return i;
+    }
+    static std::size_t from_fixed_simd(double *dst, const std::int32_t *src, std::size_t size, double scale) {
+        const __m256d s = _mm256_set1_pd(scale);
+        std::size_t i = 0;
+        for ( ; i + 4 <= size; i += 4 ) {
+            const __m256d v = _mm256_cvtepi32_pd(_mm_loadu_si128(__YAS_RCAST(const __m128i *, src + i)));
+            _mm256_storeu_pd(dst + i, _mm256_div_pd(v, s));
+        }
+        return i;
+    }
+#endif // __YAS_AVX2
+};
+
+/***************************************************************************/
+
+} // ns detail
+} // ns yas
+
+#endif // __yas__detail__tools__quantize_hpp
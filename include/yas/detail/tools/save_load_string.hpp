@@ -36,9 +36,22 @@
 #ifndef __yas__detail__tools__save_load_string_hpp
 #define __yas__detail__tools__save_load_string_hpp
 
+#include <yas/detail/config/config.hpp>
+#include <yas/detail/type_traits/type_traits.hpp>
+#include <yas/detail/tools/cast.hpp>
+#include <yas/buffers.hpp>
+
 #include <string>
-#include <vector>
 #include <cassert>
+#include <cstring>
+#include <cstdint>
+
+#if defined(__YAS_SSE2)
+#   include <immintrin.h>
+#endif
+#if defined(_MSC_VER) && !defined(__clang__)
+#   include <intrin.h>
+#endif
 
 #if defined(YAS_SERIALIZE_BOOST_TYPES)
 #   include <boost/container/string.hpp>
@@ -51,161 +64,40 @@ namespace detail {
 
 // based on the code from: https://github.com/nlohmann/json/blob/develop/src/json.hpp
 
-template<typename CharT>
-std::size_t string_extra_space(const CharT *s) {
-    std::size_t res = 0;
-    for ( ; *s; ++s ) {
-        switch ( *s ) {
-            case '"':
-            case '\\':
-            case '\b':
-            case '\f':
-            case '\n':
-            case '\r':
-            case '\t': {
-                // from c (1 byte) to \x (2 bytes)
-                res += 1;
-                break;
-            }
-
-            case 0x00:
-            case 0x01:
-            case 0x02:
-            case 0x03:
-            case 0x04:
-            case 0x05:
-            case 0x06:
-            case 0x07:
-            case 0x0b:
-            case 0x0e:
-            case 0x0f:
-            case 0x10:
-            case 0x11:
-            case 0x12:
-            case 0x13:
-            case 0x14:
-            case 0x15:
-            case 0x16:
-            case 0x17:
-            case 0x18:
-            case 0x19:
-            case 0x1a:
-            case 0x1b:
-            case 0x1c:
-            case 0x1d:
-            case 0x1e:
-            case 0x1f: {
-                // from c (1 byte) to \uxxxx (6 bytes)
-                res += 5;
-            }
-        }
-    }
-
-    return res;
-}
-
-template<typename CharT>
-void string_escape(CharT *d, const CharT *s) {
-    std::size_t pos = 0;
-
-    for ( ; *s; ++s ) {
-        switch ( *s ) {
-            // quotation mark (0x22)
-            case '"': {
-                d[pos + 1] = '"';
-                pos += 2;
-                break;
-            }
-            // reverse solidus (0x5c)
-            case '\\': {
-                // nothing to change
-                pos += 2;
-                break;
-            }
-
-            // backspace (0x08)
-            case '\b': {
-                d[pos + 1] = 'b';
-                pos += 2;
-                break;
-            }
-
-            // formfeed (0x0c)
-            case '\f': {
-                d[pos + 1] = 'f';
-                pos += 2;
-                break;
-            }
-
-            // newline (0x0a)
-            case '\n': {
-                d[pos + 1] = 'n';
-                pos += 2;
-                break;
-            }
-
-            // carriage return (0x0d)
-            case '\r': {
-                d[pos + 1] = 'r';
-                pos += 2;
-                break;
-            }
-
-            // horizontal tab (0x09)
-            case '\t': {
-                d[pos + 1] = 't';
-                pos += 2;
-                break;
-            }
-
-            case 0x00:
-            case 0x01:
-            case 0x02:
-            case 0x03:
-            case 0x04:
-            case 0x05:
-            case 0x06:
-            case 0x07:
-            case 0x0b:
-            case 0x0e:
-            case 0x0f:
-            case 0x10:
-            case 0x11:
-            case 0x12:
-            case 0x13:
-            case 0x14:
-            case 0x15:
-            case 0x16:
-            case 0x17:
-            case 0x18:
-            case 0x19:
-            case 0x1a:
-            case 0x1b:
-            case 0x1c:
-            case 0x1d:
-            case 0x1e:
-            case 0x1f: {
-                // convert a number 0..15 to its hex representation
-                // (0..f)
-                static const char hexify[16] = {
-                    '0', '1', '2', '3', '4', '5', '6', '7',
-                    '8', '9', 'a', 'b', 'c', 'd', 'e', 'f'
-                };
-
-                // print character c as \uxxxx
-                for (const char m : {'u', '0', '0', hexify[(*s) >> 4], hexify[(*s) & 0x0f]}) {
-                    d[++pos] = m;
-                }
-
-                ++pos;
-                break;
-            }
-
-            default: {
-                // all other characters are added as-is
-                d[pos++] = *s;
-                break;
-            }
+// writes the escape sequence of the quote, the backslash or the control
+// character 'ch' and returns its length
+inline std::size_t string_escape_char(char *d, std::uint8_t ch) {
+    d[0] = '\\';
+    switch ( ch ) {
+        // quotation mark (0x22)
+        case '"': d[1] = '"'; return 2;
+        // reverse solidus (0x5c)
+        case '\\': d[1] = '\\'; return 2;
+        // backspace (0x08)
+        case '\b': d[1] = 'b'; return 2;
+        // formfeed (0x0c)
+        case '\f': d[1] = 'f'; return 2;
+        // newline (0x0a)
+        case '\n': d[1] = 'n'; return 2;
+        // carriage return (0x0d)
+        case '\r': d[1] = 'r'; return 2;
+        // horizontal tab (0x09)
+        case '\t': d[1] = 't'; return 2;
+        default: {
+            // convert a number 0..15 to its hex representation (0..f)
+            static const char hexify[16] = {
+                '0', '1', '2', '3', '4', '5', '6', '7',
+                '8', '9', 'a', 'b', 'c', 'd', 'e', 'f'
+            };
+
+            // print character c as \uxxxx
+            d[1] = 'u';
+            d[2] = '0';
+            d[3] = '0';
+            d[4] = hexify[ch >> 4];
+            d[5] = hexify[ch & 0x0f];
+
+            return 6;
         }
     }
 }
@@ -214,8 +106,7 @@ template<typename Archive>
 static int string_get_codepoint(Archive &ar)  {
     int codepoint = 0;
 
-    char ch0;
-    ar.read(ch0);
+    const char ch0 = ar.getch();
     switch ( ch0 ) {
         case '0': break;
         case '1': codepoint += 0x1000; break;
@@ -242,8 +133,7 @@ static int string_get_codepoint(Archive &ar)  {
         default: return -1;
     }
 
-    char ch1;
-    ar.read(ch1);
+    const char ch1 = ar.getch();
     switch ( ch1 ) {
         case '0': break;
         case '1': codepoint += 0x0100; break;
@@ -270,8 +160,7 @@ static int string_get_codepoint(Archive &ar)  {
         default: return -1;
     }
 
-    char ch2;
-    ar.read(ch2);
+    const char ch2 = ar.getch();
     switch ( ch2 ) {
         case '0': break;
         case '1': codepoint += 0x0010; break;
@@ -298,8 +187,7 @@ static int string_get_codepoint(Archive &ar)  {
         default: return -1;
     }
 
-    char ch3;
-    ar.read(ch3);
+    const char ch3 = ar.getch();
     switch ( ch3 ) {
         case '0': break;
         case '1': codepoint += 0x0001; break;
@@ -329,6 +217,237 @@ static int string_get_codepoint(Archive &ar)  {
     return codepoint;
 }
 
+/***************************************************************************/
+
+// The plain runs of a JSON string - everything but the quote, the backslash
+// and the control characters - are located, validated and copied in bulk when
+// the input stream is contiguous in memory. The bytes are taken one by one
+// through the switch below only for the escapes and for the other streams.
+
+template<typename Archive>
+intrusive_buffer string_input_buffer(const Archive &ar, std::true_type) {
+    return ar.get_intrusive_buffer();
+}
+
+template<typename Archive>
+intrusive_buffer string_input_buffer(const Archive &, std::false_type) {
+    return intrusive_buffer(nullptr, 0);
+}
+
+inline std::size_t string_first_bit(unsigned mask) {
+#if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long idx;
+    _BitScanForward(&idx, mask);
+    return idx;
+#else
+    return __YAS_SCAST(std::size_t, __builtin_ctz(mask));
+#endif
+}
+
+// the length of the leading run without the quote, the backslash and the control characters
+inline std::size_t string_plain_run(const char *s, std::size_t n) {
+    std::size_t i = 0;
+#if defined(__YAS_SSE2)
+    const __m128i quote = _mm_set1_epi8('"');
+    const __m128i bslash = _mm_set1_epi8('\\');
+    const __m128i ctrl = _mm_set1_epi8(0x1f);
+    for ( ; i + 16 <= n; i += 16 ) {
+        const __m128i v = _mm_loadu_si128(__YAS_RCAST(const __m128i *, s + i));
+        const __m128i special = _mm_or_si128(
+             _mm_or_si128(_mm_cmpeq_epi8(v, quote), _mm_cmpeq_epi8(v, bslash))
+            ,_mm_cmpeq_epi8(_mm_max_epu8(v, ctrl), ctrl)
+        );
+        const unsigned mask = __YAS_SCAST(unsigned, _mm_movemask_epi8(special));
+        if ( mask ) {
+            return i + string_first_bit(mask);
+        }
+    }
+#endif // __YAS_SSE2
+
+    for ( ; i < n; ++i ) {
+        const std::uint8_t ch = __YAS_SCAST(std::uint8_t, s[i]);
+        if ( ch == '"' || ch == '\\' || ch < 0x20 ) {
+            break;
+        }
+    }
+
+    return i;
+}
+
+// the same rules as the switch in string_read_string(): no overlong forms,
+// no surrogates, nothing above U+10FFFF
+inline bool string_is_utf8_scalar(const std::uint8_t *s, std::size_t n) {
+    for ( std::size_t i = 0; i < n; ) {
+        const std::uint8_t ch = s[i];
+        if ( ch < 0x80 ) {
+#if defined(__YAS_SSE2)
+            // skip the ASCII blocks, 'i' is at the start of a sequence
+            while ( i + 16 <= n && !_mm_movemask_epi8(_mm_loadu_si128(__YAS_RCAST(const __m128i *, s + i))) ) {
+                i += 16;
+            }
+            if ( i < n && s[i] < 0x80 ) {
+                ++i;
+            }
+#else
+            ++i;
+#endif // __YAS_SSE2
+            continue;
+        }
+
+        std::size_t len;
+        std::uint8_t lo = 0x80, hi = 0xbf;
+        if ( ch >= 0xc2 && ch <= 0xdf ) {
+            len = 2;
+        } else if ( ch >= 0xe0 && ch <= 0xef ) {
+            len = 3;
+            if ( ch == 0xe0 ) lo = 0xa0;
+            if ( ch == 0xed ) hi = 0x9f;
+        } else if ( ch >= 0xf0 && ch <= 0xf4 ) {
+            len = 4;
+            if ( ch == 0xf0 ) lo = 0x90;
+            if ( ch == 0xf4 ) hi = 0x8f;
+        } else {
+            return false;
+        }
+
+        if ( n - i < len || s[i+1] < lo || s[i+1] > hi ) {
+            return false;
+        }
+        for ( std::size_t j = 2; j < len; ++j ) {
+            if ( (s[i+j] & 0xc0) != 0x80 ) {
+                return false;
+            }
+        }
+
+        i += len;
+    }
+
+    return true;
+}
+
+#if defined(__YAS_SSSE3)
+
+// the lookup based validation by J. Keiser and D. Lemire,
+// "Validating UTF-8 In Less Than One Instruction Per Byte"
+struct string_utf8_checker {
+    __m128i error = _mm_setzero_si128();
+    __m128i prev_input = _mm_setzero_si128();
+    __m128i prev_incomplete = _mm_setzero_si128();
+
+    void check_block(__m128i input) {
+        if ( !_mm_movemask_epi8(input) ) {
+            // an ASCII block can only be wrong because of the previous one
+            error = _mm_or_si128(error, prev_incomplete);
+            prev_input = input;
+            prev_incomplete = _mm_setzero_si128();
+            return;
+        }
+
+        const __m128i prev1 = _mm_alignr_epi8(input, prev_input, 16-1);
+        const __m128i prev2 = _mm_alignr_epi8(input, prev_input, 16-2);
+        const __m128i prev3 = _mm_alignr_epi8(input, prev_input, 16-3);
+
+        const __m128i special = special_cases(input, prev1);
+        const __m128i is_third = _mm_subs_epu8(prev2, _mm_set1_epi8(__YAS_SCAST(char, 0xe0-0x80)));
+        const __m128i is_fourth = _mm_subs_epu8(prev3, _mm_set1_epi8(__YAS_SCAST(char, 0xf0-0x80)));
+        const __m128i must23 = _mm_and_si128(_mm_or_si128(is_third, is_fourth), _mm_set1_epi8(__YAS_SCAST(char, 0x80)));
+
+        error = _mm_or_si128(error, _mm_xor_si128(must23, special));
+        prev_input = input;
+        // the last three bytes can start a sequence continued in the next block
+        prev_incomplete = _mm_subs_epu8(input, _mm_setr_epi8(
+             -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1
+            ,__YAS_SCAST(char, 0xf0-1), __YAS_SCAST(char, 0xe0-1), __YAS_SCAST(char, 0xc0-1)
+        ));
+    }
+
+    bool finish() const {
+        const __m128i e = _mm_or_si128(error, prev_incomplete);
+        return _mm_movemask_epi8(_mm_cmpeq_epi8(e, _mm_setzero_si128())) == 0xffff;
+    }
+
+private:
+    static __m128i special_cases(__m128i input, __m128i prev1) {
+        enum: std::uint8_t {
+             too_short      = 1<<0 // a lead byte followed by a lead byte or ASCII
+            ,too_long       = 1<<1 // ASCII followed by a continuation
+            ,overlong_3     = 1<<2 // E0 80..9F
+            ,too_large      = 1<<3 // F4 90..BF, F5..FF
+            ,surrogate      = 1<<4 // ED A0..BF
+            ,overlong_2     = 1<<5 // C0..C1
+            ,too_large_1000 = 1<<6 // F5..FF 80..8F
+            ,overlong_4     = 1<<6 // F0 80..8F
+            ,two_conts      = 1<<7 // a continuation followed by a continuation
+            ,carry          = too_short | too_long | two_conts
+        };
+        const __m128i nibble = _mm_set1_epi8(0x0f);
+
+        const __m128i byte_1_high = _mm_shuffle_epi8(_mm_setr_epi8(
+             too_long, too_long, too_long, too_long
+            ,too_long, too_long, too_long, too_long
+            ,two_conts, two_conts, two_conts, two_conts
+            ,too_short | overlong_2
+            ,too_short
+            ,too_short | overlong_3 | surrogate
+            ,__YAS_SCAST(char, too_short | too_large | too_large_1000 | overlong_4)
+        ), _mm_and_si128(_mm_srli_epi16(prev1, 4), nibble));
+
+        const __m128i byte_1_low = _mm_shuffle_epi8(_mm_setr_epi8(
+             carry | overlong_3 | overlong_2 | overlong_4
+            ,carry | overlong_2
+            ,carry
+            ,carry
+            ,carry | too_large
+            ,carry | too_large | too_large_1000
+            ,carry | too_large | too_large_1000
+            ,carry | too_large | too_large_1000
+            ,carry | too_large | too_large_1000
+            ,carry | too_large | too_large_1000
+            ,carry | too_large | too_large_1000
+            ,carry | too_large | too_large_1000
+            ,carry | too_large | too_large_1000
+            ,carry | too_large | too_large_1000 | surrogate
+            ,carry | too_large | too_large_1000
+            ,carry | too_large | too_large_1000
+        ), _mm_and_si128(prev1, nibble));
+
+        const __m128i byte_2_high = _mm_shuffle_epi8(_mm_setr_epi8(
+             too_short, too_short, too_short, too_short
+            ,too_short, too_short, too_short, too_short
+            ,__YAS_SCAST(char, too_long | overlong_2 | two_conts | overlong_3 | too_large_1000 | overlong_4)
+            ,__YAS_SCAST(char, too_long | overlong_2 | two_conts | overlong_3 | too_large)
+            ,__YAS_SCAST(char, too_long | overlong_2 | two_conts | surrogate | too_large)
+            ,__YAS_SCAST(char, too_long | overlong_2 | two_conts | surrogate | too_large)
+            ,too_short, too_short, too_short, too_short
+        ), _mm_and_si128(_mm_srli_epi16(input, 4), nibble));
+
+        return _mm_and_si128(_mm_and_si128(byte_1_high, byte_1_low), byte_2_high);
+    }
+};
+
+#endif // __YAS_SSSE3
+
+inline bool string_is_utf8(const char *s, std::size_t n) {
+#if defined(__YAS_SSSE3)
+    string_utf8_checker checker;
+    std::size_t i = 0;
+    for ( ; i + 16 <= n; i += 16 ) {
+        checker.check_block(_mm_loadu_si128(__YAS_RCAST(const __m128i *, s + i)));
+    }
+
+    // the zero padding is ASCII, so a sequence cut by the end is reported
+    char tail[16] = {0};
+    std::memcpy(tail, s + i, n - i);
+    checker.check_block(_mm_loadu_si128(__YAS_RCAST(const __m128i *, tail)));
+
+    return checker.finish();
+#else
+    return string_is_utf8_scalar(__YAS_RCAST(const std::uint8_t *, s), n);
+#endif // __YAS_SSSE3
+}
+
+/***************************************************************************/
+
 template<
      typename Archive
     ,template<typename, typename, typename> class StringT
@@ -347,6 +466,20 @@ static void string_read_string(StringT<CharT, TraitsT, AllocatorT> &d, Archive &
 
     auto dit = std::back_inserter(d);
     while ( true ) {
+        const intrusive_buffer buf = string_input_buffer(ar, has_intrusive_buffer<Archive>{});
+        if ( buf.size ) {
+            const std::size_t n = string_plain_run(buf.data, buf.size);
+            if ( n ) {
+                if ( __JSON_UNLIKELY(!string_is_utf8(buf.data, n)) ) {
+                    __YAS_THROW_INVALID_JSON_STRING("invalid string: ill-formed UTF-8 byte");
+                }
+
+                const std::size_t size = d.size();
+                d.resize(size + n);
+                ar.read(&d[size], n);
+            }
+        }
+
         std::uint8_t ch = ar.getch();
 
         switch ( ch ) {
@@ -773,21 +906,30 @@ template<
     ,typename CharT
 >
 Archive& save_string(Archive &ar, const CharT *str, std::size_t len) {
-    //TODO: зачем создавать временную строку для экранирования, если можно экранировать записывая в архив!
-    const std::size_t n = string_extra_space(str);
-    // must be escaped
-    if ( n ) {
-        std::vector<CharT> escaped(len + n, '\\');
-        string_escape(escaped.data(), str);
-
-        ar.write(escaped.data(), escaped.size());
-    } else {
-        ar.write(str, len);
+    static_assert(sizeof(CharT) == 1, "only the byte strings can be escaped");
+
+    // the plain runs are written as is, the escapes are written in between
+    const char *s = __YAS_RCAST(const char *, str);
+    while ( true ) {
+        const std::size_t n = string_plain_run(s, len);
+        if ( n ) {
+            ar.write(s, n);
+        }
+        if ( n == len ) {
+            break;
+        }
+
+        char escaped[6];
+        ar.write(escaped, string_escape_char(escaped, __YAS_SCAST(std::uint8_t, s[n])));
+        s += n + 1;
+        len -= n + 1;
     }
 
     return ar;
 }
 
+/***************************************************************************/
+
 template<
      typename Archive
     ,template<typename, typename, typename> class StringT
@@ -0,0 +1,249 @@
+
+// Copyright (c) 2010-2021 niXman (github dot nixman at pm dot me). All
+// rights reserved.
+//
+// This file is part of YAS(https://github.com/niXman/yas) project.
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//
+//
+// Boost Software License - Version 1.0 - August 17th, 2003
+//
+// Permission is hereby granted, free of charge, to any person or organization
+// obtaining a copy of the software and accompanying documentation covered by
+// this license (the "Software") to use, reproduce, display, distribute,
+// execute, and transmit the Software, and to prepare derivative works of the
+// Software, and to permit third-parties to whom the Software is furnished to
+// do so, all subject to the following:
+//
+// The copyright notices in the Software and this entire statement, including
+// the above license grant, this restriction and the following disclaimer,
+// must be included in all copies of the Software, in whole or in part, and
+// all derivative works of the Software, unless such copies or derivative
+// works are solely in the form of machine-executable object code generated by
+// a source language processor.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+// SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+// FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+
+
+#ifndef __yas__detail__tools__shortest_dtoa_hpp
+#define __yas__detail__tools__shortest_dtoa_hpp
+
+#include <yas/detail/tools/cast.hpp>
+#include <yas/detail/tools/fast_atod.hpp>
+#include <yas/detail/tools/fast_itoa.hpp>
+#include <yas/detail/tools/rapidjson_dtoa.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <cmath>
+
+namespace yas {
+namespace detail {
+
+/***************************************************************************/
+
+// The shortest decimal representation which reads back to the same value,
+// by R. Giulietti, "The Schubfach way to render doubles". The float32 and
+// float64 values have their own paths, so a float is printed with the digits
+// of the float and not of the widened double. The decimal is then laid out
+// by Prettify(), so the format is the same as of the Grisu2 formatter.
+
+struct dtoa_decimal {
+    std::uint64_t digits;
+    std::int32_t exponent;
+};
+
+inline std::int32_t dtoa_floor_log2_pow10(std::int32_t e) {
+    return (e * 1741647) >> 19;
+}
+
+inline std::int32_t dtoa_floor_log10_pow2(std::int32_t e) {
+    return (e * 1262611) >> 22;
+}
+
+inline std::int32_t dtoa_floor_log10_three_quarters_pow2(std::int32_t e) {
+    return (e * 1262611 - 524031) >> 22;
+}
+
+// 10^k normalized to 128 bits and rounded up
+inline atod_u128 dtoa_pow10(std::int32_t k) {
+    const std::uint64_t *p = atod_powers_of_five() + 2 * (k + 342);
+    atod_u128 g;
+    g.high = p[0];
+    g.low = p[1];
+    // see the comment on the table
+    if ( k < -27 || k > 55 ) {
+        ++g.low;
+        g.high += (g.low == 0);
+    }
+
+    return g;
+}
+
+inline std::uint64_t dtoa_round_to_odd(const atod_u128 &g, std::uint64_t cp) {
+    const atod_u128 x = atod_mul(g.low, cp);
+    const atod_u128 y = atod_mul(g.high, cp);
+    const std::uint64_t y0 = y.low + x.high;
+    const std::uint64_t y1 = y.high + (y0 < x.high);
+
+    return y1 | (y0 > 1);
+}
+
+inline std::uint32_t dtoa_round_to_odd(std::uint64_t g, std::uint32_t cp) {
+    const atod_u128 p = atod_mul(g, cp);
+    const std::uint32_t y1 = __YAS_SCAST(std::uint32_t, p.high);
+    const std::uint32_t y0 = __YAS_SCAST(std::uint32_t, p.low >> 32);
+
+    return y1 | (y0 > 1);
+}
+
+template<typename UInt>
+dtoa_decimal dtoa_select(UInt vbl, UInt vb, UInt vbr, bool is_even, std::int32_t k) {
+    const UInt lower = vbl + !is_even;
+    const UInt upper = vbr - !is_even;
+
+    // the shorter one of the two candidates with one digit less
+    const UInt s = vb / 4;
+    if ( s >= 10 ) {
+        const UInt sp = s / 10;
+        const bool up_inside = lower <= 40 * sp;
+        const bool wp_inside = 40 * sp + 40 <= upper;
+        if ( up_inside != wp_inside ) {
+            return dtoa_decimal{sp + wp_inside, k + 1};
+        }
+    }
+
+    const bool u_inside = lower <= 4 * s;
+    const bool w_inside = 4 * s + 4 <= upper;
+    if ( u_inside != w_inside ) {
+        return dtoa_decimal{s + w_inside, k};
+    }
+
+    // both are inside, the closest one wins
+    const UInt mid = 4 * s + 2;
+    const bool round_up = vb > mid || (vb == mid && (s & 1) != 0);
+
+    return dtoa_decimal{s + round_up, k};
+}
+
+// the finite non-zero values only
+inline dtoa_decimal dtoa_to_decimal(double v) {
+    std::uint64_t bits;
+    std::memcpy(&bits, &v, sizeof(bits));
+    const std::uint64_t significand = bits & ((std::uint64_t(1) << 52) - 1);
+    const std::uint32_t exponent = __YAS_SCAST(std::uint32_t, (bits >> 52) & 0x7ff);
+
+    std::uint64_t c;
+    std::int32_t q;
+    if ( exponent != 0 ) {
+        c = (std::uint64_t(1) << 52) | significand;
+        q = __YAS_SCAST(std::int32_t, exponent) - 1075;
+        // the small integers
+        if ( q <= 0 && q > -53 && ((c >> -q) << -q) == c ) {
+            return dtoa_decimal{c >> -q, 0};
+        }
+    } else {
+        c = significand;
+        q = -1074;
+    }
+
+    const bool is_even = (c % 2) == 0;
+    const bool lower_is_closer = significand == 0 && exponent > 1;
+    const std::uint64_t cbl = 4 * c - 2 + lower_is_closer;
+    const std::uint64_t cb = 4 * c;
+    const std::uint64_t cbr = 4 * c + 2;
+
+    const std::int32_t k = lower_is_closer ? dtoa_floor_log10_three_quarters_pow2(q) : dtoa_floor_log10_pow2(q);
+    const std::int32_t h = q + dtoa_floor_log2_pow10(-k) + 1;
+    const atod_u128 g = dtoa_pow10(-k);
+
+    return dtoa_select(
+         dtoa_round_to_odd(g, cbl << h)
+        ,dtoa_round_to_odd(g, cb << h)
+        ,dtoa_round_to_odd(g, cbr << h)
+        ,is_even
+        ,k
+    );
+}
+
+inline dtoa_decimal dtoa_to_decimal(float v) {
+    std::uint32_t bits;
+    std::memcpy(&bits, &v, sizeof(bits));
+    const std::uint32_t significand = bits & ((std::uint32_t(1) << 23) - 1);
+    const std::uint32_t exponent = (bits >> 23) & 0xff;
+
+    std::uint32_t c;
+    std::int32_t q;
+    if ( exponent != 0 ) {
+        c = (std::uint32_t(1) << 23) | significand;
+        q = __YAS_SCAST(std::int32_t, exponent) - 150;
+        if ( q <= 0 && q > -24 && ((c >> -q) << -q) == c ) {
+            return dtoa_decimal{c >> -q, 0};
+        }
+    } else {
+        c = significand;
+        q = -149;
+    }
+
+    const bool is_even = (c % 2) == 0;
+    const bool lower_is_closer = significand == 0 && exponent > 1;
+    const std::uint32_t cbl = 4 * c - 2 + lower_is_closer;
+    const std::uint32_t cb = 4 * c;
+    const std::uint32_t cbr = 4 * c + 2;
+
+    const std::int32_t k = lower_is_closer ? dtoa_floor_log10_three_quarters_pow2(q) : dtoa_floor_log10_pow2(q);
+    const std::int32_t h = q + dtoa_floor_log2_pow10(-k) + 1;
+    // the upper 64 bits, rounded up
+    const atod_u128 g128 = dtoa_pow10(-k);
+    const std::uint64_t g = g128.high + (g128.low != 0);
+
+    return dtoa_select(
+         dtoa_round_to_odd(g, cbl << h)
+        ,dtoa_round_to_odd(g, cb << h)
+        ,dtoa_round_to_odd(g, cbr << h)
+        ,is_even
+        ,k
+    );
+}
+
+// returns the end of the written representation
+template<typename T>
+char* shortest_dtoa(T value, char *buf) {
+    if ( value == 0 ) {
+        if ( std::signbit(value) ) {
+            *buf++ = '-';
+        }
+        std::memcpy(buf, "0.0", 3);
+
+        return buf + 3;
+    }
+    if ( value < 0 ) {
+        *buf++ = '-';
+        value = -value;
+    }
+
+    dtoa_decimal d = dtoa_to_decimal(value);
+    for ( ; d.digits % 10 == 0; d.digits /= 10 ) {
+        ++d.exponent;
+    }
+
+    const int len = __YAS_SCAST(int, fast_utoa(buf, d.digits) - buf);
+
+    return Prettify(buf, len, d.exponent, 324);
+}
+
+/***************************************************************************/
+
+} // ns detail
+} // ns yas
+
+#endif // __yas__detail__tools__shortest_dtoa_hpp
@@ -0,0 +1,175 @@
+
+// Copyright (c) 2010-2021 niXman (github dot nixman at pm dot me). All
+// rights reserved.
+//
+// This file is part of YAS(https://github.com/niXman/yas) project.
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//
+//
+// Boost Software License - Version 1.0 - August 17th, 2003
+//
+// Permission is hereby granted, free of charge, to any person or organization
+// obtaining a copy of the software and accompanying documentation covered by
+// this license (the "Software") to use, reproduce, display, distribute,
+// execute, and transmit the Software, and to prepare derivative works of the
+// Software, and to permit third-parties to whom the Software is furnished to
+// do so, all subject to the following:
+//
+// The copyright notices in the Software and this entire statement, including
+// the above license grant, this restriction and the following disclaimer,
+// must be included in all copies of the Software, in whole or in part, and
+// all derivative works of the Software, unless such copies or derivative
+// works are solely in the form of machine-executable object code generated by
+// a source language processor.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+// SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+// FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+
+
+#ifndef __yas__detail__tools__strings_dict_hpp
+#define __yas__detail__tools__strings_dict_hpp
+
+#include <yas/detail/config/config.hpp>
+#include <yas/detail/type_traits/flags.hpp>
+#include <yas/detail/tools/cast.hpp>
+
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace yas {
+namespace detail {
+
+/***************************************************************************/
+
+// the strings of binary archives with 'yas::interned' are written as a varint tag:
+//   (index << 1) | 1 - the back-reference to the string seen before,
+//   (size << 1) | 0  - the new string, followed by its bytes.
+// only the non-empty strings up to 'max_size' bytes are added to the dictionary,
+// so the writer and the reader always agree on the indexes.
+struct strings_dict {
+    enum: std::size_t { max_size = 256 };
+
+    static bool internable(std::size_t size) { return size && size <= max_size; }
+};
+
+// the open addressing hash table over the stored strings
+struct strings_dict_writer {
+    strings_dict_writer()
+        :strings()
+        ,slots(64, 0u)
+    {}
+
+    // returns the index of the string seen before, or the index of the just added one
+    // and 'false' as the second
+    std::pair<std::size_t, bool> insert(const char *ptr, std::size_t size) {
+        const std::size_t mask = slots.size() - 1;
+        std::size_t pos = hash(ptr, size) & mask;
+        for ( ; slots[pos]; pos = (pos + 1) & mask ) {
+            const std::string &s = strings[slots[pos] - 1];
+            if ( s.size() == size && 0 == std::memcmp(s.data(), ptr, size) ) {
+                return {slots[pos] - 1, true};
+            }
+        }
+
+        strings.emplace_back(ptr, size);
+        slots[pos] = __YAS_SCAST(std::uint32_t, strings.size());
+        if ( strings.size() * 2 > slots.size() ) {
+            rehash();
+        }
+
+        return {strings.size() - 1, false};
+    }
+
+private:
+    static std::size_t hash(const char *ptr, std::size_t size) {
+        std::uint32_t h = 0x811c9dc5;
+        for ( std::size_t i = 0; i < size; ++i ) {
+            h = __YAS_SCAST(std::uint32_t, (h ^ __YAS_SCAST(std::uint8_t, ptr[i])) * __YAS_SCAST(std::uint64_t, 0x01000193));
+        }
+
+        return h;
+    }
+
+    void rehash() {
+        std::vector<std::uint32_t> tmp(slots.size() * 2, 0u);
+        const std::size_t mask = tmp.size() - 1;
+        for ( std::size_t i = 0; i < strings.size(); ++i ) {
+            std::size_t pos = hash(strings[i].data(), strings[i].size()) & mask;
+            for ( ; tmp[pos]; pos = (pos + 1) & mask )
+                ;
+            tmp[pos] = __YAS_SCAST(std::uint32_t, i + 1);
+        }
+        slots.swap(tmp);
+    }
+
+    std::vector<std::string> strings;
+    std::vector<std::uint32_t> slots; // the index + 1, or zero for the empty slot
+};
+
+struct strings_dict_reader {
+    const std::string* find(std::size_t idx) const {
+        return idx < strings.size() ? &strings[idx] : nullptr;
+    }
+    void insert(const char *ptr, std::size_t size) {
+        strings.emplace_back(ptr, size);
+    }
+
+private:
+    std::vector<std::string> strings;
+};
+
+// for the archives without 'yas::interned'
+struct no_strings_dict {};
+
+/***************************************************************************/
+
+template<std::size_t F, typename Archive>
+void save_string_bytes(Archive &ar, const char *ptr, std::size_t size, std::true_type) {
+    ar.write_interned(ptr, size);
+}
+
+template<std::size_t F, typename Archive>
+void save_string_bytes(Archive &ar, const char *ptr, std::size_t size, std::false_type) {
+    ar.write_seq_size(size);
+    ar.write(ptr, size);
+}
+
+// the size and the bytes of the binary/text string, or the dictionary reference
+template<std::size_t F, typename Archive>
+void save_string_bytes(Archive &ar, const char *ptr, std::size_t size) {
+    save_string_bytes<F>(ar, ptr, size, std::integral_constant<bool, (F & yas::binary) && (F & yas::interned)>{});
+}
+
+template<std::size_t F, typename Archive, typename S>
+void load_string_bytes(Archive &ar, S &str, std::true_type) {
+    ar.read_interned(str);
+}
+
+template<std::size_t F, typename Archive, typename S>
+void load_string_bytes(Archive &ar, S &str, std::false_type) {
+    const auto size = ar.read_seq_size();
+    str.resize(size);
+    ar.read(__YAS_CCAST(char*, str.data()), size);
+}
+
+template<std::size_t F, typename Archive, typename S>
+void load_string_bytes(Archive &ar, S &str) {
+    load_string_bytes<F>(ar, str, std::integral_constant<bool, (F & yas::binary) && (F & yas::interned)>{});
+}
+
+/***************************************************************************/
+
+} // ns detail
+} // ns yas
+
+#endif // __yas__detail__tools__strings_dict_hpp
@@ -33,12 +33,20 @@
 // ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
 // DEALINGS IN THE SOFTWARE.
 
+
 #ifndef __yas__detail__tools__utf8conv_hpp
 #define __yas__detail__tools__utf8conv_hpp
 
+#include <yas/detail/config/config.hpp>
 #include <yas/detail/tools/cast.hpp>
+#include <yas/detail/io/serialization_exceptions.hpp>
 
 #include <string>
+#include <cstdint>
+
+#if defined(__YAS_SSE2)
+#	include <immintrin.h>
+#endif
 
 #if defined(YAS_SERIALIZE_BOOST_TYPES)
 #	include <boost/container/string.hpp>
@@ -47,64 +55,343 @@
 namespace yas {
 namespace detail {
 
-// Based on the code by Avanesov Tigran, 2009-2011:
-// http://forum.vingrad.ru/index.php?showtopic=249965&view=findpost&p=1803380
-// http://forum.vingrad.ru/index.php?showtopic=249965&view=findpost&p=1803439
+/***************************************************************************/
+
+// The conversions are done in two passes: the exact size of the result is
+// computed first, so the destination is resized once and filled through a
+// raw pointer. Runs of ASCII are copied by the SIMD loops below, the
+// multi-byte sequences are handled by the scalar code.
+//
+// UTF-16 surrogate pairs are encoded as one 4-byte sequence. Lone surrogates
+// are encoded as 3-byte sequences (WTF-8) so that any wide string survives the
+// round trip; code units above 0x10FFFF are replaced by U+FFFD.
+// The decoder rejects truncated, overlong and out of range sequences.
+
+template<std::size_t N>
+using utf_unit_size = std::integral_constant<std::size_t, N>;
 
 /***************************************************************************/
 
-template<typename D, typename S>
-void to_utf8(D &dst, const S &src) {
-	for ( auto it = src.begin(); it != src.end(); ++it ) {
-		std::wstring::value_type nchar = *it;
-		if (nchar <= 0x7F) {
-			dst += __YAS_SCAST(std::string::value_type, nchar);
-		} else if (nchar <= 0x07FF) {
-			dst += __YAS_SCAST(char, 0xC0 | (nchar >> 6));
-			dst += __YAS_SCAST(char, 0x80 | (nchar & 0x3F));
-		} else if (nchar <= 0xFFFF) {
-			dst += __YAS_SCAST(char, 0xE0 | (nchar >> 12));
-			dst += __YAS_SCAST(char, 0x80 | ((nchar >> 6) & 0x3F));
-			dst += __YAS_SCAST(char, 0x80 | (nchar & 0x3F));
+#if defined(__YAS_SSE2)
+
+// all of the 16/32 units starting at 'p' are ASCII: narrow them into 'd'
+inline bool utf8_ascii_narrow(char *d, const char16_t *p) {
+#if defined(__YAS_AVX2)
+	const __m256i v0 = _mm256_loadu_si256(__YAS_RCAST(const __m256i *, p));
+	const __m256i v1 = _mm256_loadu_si256(__YAS_RCAST(const __m256i *, p + 16));
+	if ( !_mm256_testz_si256(_mm256_or_si256(v0, v1), _mm256_set1_epi16(__YAS_SCAST(short, 0xFF80))) )
+		return false;
+
+	const __m256i r = _mm256_permute4x64_epi64(_mm256_packus_epi16(v0, v1), 0xD8);
+	_mm256_storeu_si256(__YAS_RCAST(__m256i *, d), r);
+#else
+	const __m128i v0 = _mm_loadu_si128(__YAS_RCAST(const __m128i *, p));
+	const __m128i v1 = _mm_loadu_si128(__YAS_RCAST(const __m128i *, p + 8));
+	const __m128i hi = _mm_and_si128(_mm_or_si128(v0, v1), _mm_set1_epi16(__YAS_SCAST(short, 0xFF80)));
+	if ( _mm_movemask_epi8(_mm_cmpeq_epi16(hi, _mm_setzero_si128())) != 0xFFFF )
+		return false;
+
+	_mm_storeu_si128(__YAS_RCAST(__m128i *, d), _mm_packus_epi16(v0, v1));
+#endif
+
+	return true;
+}
+
+inline bool utf8_ascii_narrow(char *d, const char32_t *p) {
+	const __m128i v0 = _mm_loadu_si128(__YAS_RCAST(const __m128i *, p));
+	const __m128i v1 = _mm_loadu_si128(__YAS_RCAST(const __m128i *, p + 4));
+	const __m128i v2 = _mm_loadu_si128(__YAS_RCAST(const __m128i *, p + 8));
+	const __m128i v3 = _mm_loadu_si128(__YAS_RCAST(const __m128i *, p + 12));
+	const __m128i all = _mm_or_si128(_mm_or_si128(v0, v1), _mm_or_si128(v2, v3));
+	const __m128i hi = _mm_and_si128(all, _mm_set1_epi32(__YAS_SCAST(int, 0xFFFFFF80)));
+	if ( _mm_movemask_epi8(_mm_cmpeq_epi32(hi, _mm_setzero_si128())) != 0xFFFF )
+		return false;
+
+	const __m128i w0 = _mm_packs_epi32(v0, v1);
+	const __m128i w1 = _mm_packs_epi32(v2, v3);
+	_mm_storeu_si128(__YAS_RCAST(__m128i *, d), _mm_packus_epi16(w0, w1));
+
+	return true;
+}
+
+// all of the 16/32 bytes starting at 'p' are ASCII: widen them into 'd'
+inline bool utf8_ascii_widen(char16_t *d, const unsigned char *p) {
+#if defined(__YAS_AVX2)
+	const __m256i v = _mm256_loadu_si256(__YAS_RCAST(const __m256i *, p));
+	if ( _mm256_movemask_epi8(v) )
+		return false;
+
+	_mm256_storeu_si256(__YAS_RCAST(__m256i *, d), _mm256_cvtepu8_epi16(_mm256_castsi256_si128(v)));
+	_mm256_storeu_si256(__YAS_RCAST(__m256i *, d + 16), _mm256_cvtepu8_epi16(_mm256_extracti128_si256(v, 1)));
+#else
+	const __m128i v = _mm_loadu_si128(__YAS_RCAST(const __m128i *, p));
+	if ( _mm_movemask_epi8(v) )
+		return false;
+
+	const __m128i z = _mm_setzero_si128();
+	_mm_storeu_si128(__YAS_RCAST(__m128i *, d), _mm_unpacklo_epi8(v, z));
+	_mm_storeu_si128(__YAS_RCAST(__m128i *, d + 8), _mm_unpackhi_epi8(v, z));
+#endif
+
+	return true;
+}
+
+inline bool utf8_ascii_widen(char32_t *d, const unsigned char *p) {
+	const __m128i v = _mm_loadu_si128(__YAS_RCAST(const __m128i *, p));
+	if ( _mm_movemask_epi8(v) )
+		return false;
+
+	const __m128i z = _mm_setzero_si128();
+	const __m128i lo = _mm_unpacklo_epi8(v, z);
+	const __m128i hi = _mm_unpackhi_epi8(v, z);
+	_mm_storeu_si128(__YAS_RCAST(__m128i *, d), _mm_unpacklo_epi16(lo, z));
+	_mm_storeu_si128(__YAS_RCAST(__m128i *, d + 4), _mm_unpackhi_epi16(lo, z));
+	_mm_storeu_si128(__YAS_RCAST(__m128i *, d + 8), _mm_unpacklo_epi16(hi, z));
+	_mm_storeu_si128(__YAS_RCAST(__m128i *, d + 12), _mm_unpackhi_epi16(hi, z));
+
+	return true;
+}
+
+#if defined(__YAS_AVX2)
+constexpr std::size_t utf8_block_units(utf_unit_size<2>) { return 32; }
+#else
+constexpr std::size_t utf8_block_units(utf_unit_size<2>) { return 16; }
+#endif
+constexpr std::size_t utf8_block_units(utf_unit_size<4>) { return 16; }
+
+#endif // __YAS_SSE2
+
+/***************************************************************************/
+
+inline bool utf16_is_high(std::uint32_t u) { return (u & 0xFC00u) == 0xD800u; }
+inline bool utf16_is_low(std::uint32_t u) { return (u & 0xFC00u) == 0xDC00u; }
+
+// the size of the UTF-8 representation
+inline std::size_t utf8_encoded_size(const char16_t *p, std::size_t n, utf_unit_size<2>) {
+	std::size_t size = n;
+	for ( std::size_t i = 0; i < n; ++i ) {
+		const std::uint32_t u = p[i];
+		size += (u >= 0x80) + (u >= 0x800);
+		// the pair takes 4 bytes, the low surrogate adds nothing
+		if ( utf16_is_high(u) && i + 1 < n && utf16_is_low(p[i+1]) ) {
+			++i;
 		}
-#if WCHAR_MAX > 0xFFFF 
-		else if (nchar  <= 0x1FFFFF) {
-			dst += __YAS_SCAST(char, 0xF0 | (nchar >> 18));
-			dst += __YAS_SCAST(char, 0x80 | ((nchar >> 12) & 0x3F));
-			dst += __YAS_SCAST(char, 0x80 | ((nchar >> 6) & 0x3F));
-			dst += __YAS_SCAST(char, 0x80 | (nchar & 0x3F));
+	}
+
+	return size;
+}
+
+inline std::size_t utf8_encoded_size(const char32_t *p, std::size_t n, utf_unit_size<4>) {
+	std::size_t size = n;
+	for ( std::size_t i = 0; i < n; ++i ) {
+		const std::uint32_t u = p[i];
+		size += (u >= 0x80) + (u >= 0x800) + (u >= 0x10000 && u <= 0x10FFFF);
+	}
+
+	return size;
+}
+
+inline char* utf8_put(char *d, std::uint32_t c) {
+	if ( c < 0x80 ) {
+		*d++ = __YAS_SCAST(char, c);
+	} else if ( c < 0x800 ) {
+		*d++ = __YAS_SCAST(char, 0xC0 | (c >> 6));
+		*d++ = __YAS_SCAST(char, 0x80 | (c & 0x3F));
+	} else if ( c < 0x10000 ) {
+		*d++ = __YAS_SCAST(char, 0xE0 | (c >> 12));
+		*d++ = __YAS_SCAST(char, 0x80 | ((c >> 6) & 0x3F));
+		*d++ = __YAS_SCAST(char, 0x80 | (c & 0x3F));
+	} else {
+		*d++ = __YAS_SCAST(char, 0xF0 | (c >> 18));
+		*d++ = __YAS_SCAST(char, 0x80 | ((c >> 12) & 0x3F));
+		*d++ = __YAS_SCAST(char, 0x80 | ((c >> 6) & 0x3F));
+		*d++ = __YAS_SCAST(char, 0x80 | (c & 0x3F));
+	}
+
+	return d;
+}
+
+// encodes the units [i, end) and returns the index of the next unit,
+// which can be 'end+1' when a surrogate pair straddles 'end'
+inline std::size_t utf8_encode_units(char *&d, const char16_t *p, std::size_t i, std::size_t end, std::size_t n) {
+	for ( ; i < end; ++i ) {
+		std::uint32_t c = p[i];
+		if ( utf16_is_high(c) && i + 1 < n && utf16_is_low(p[i+1]) ) {
+			c = 0x10000 + ((c - 0xD800) << 10) + (p[i+1] - 0xDC00u);
+			++i;
 		}
-#endif
+		d = utf8_put(d, c);
+	}
+
+	return i;
+}
+
+inline std::size_t utf8_encode_units(char *&d, const char32_t *p, std::size_t i, std::size_t end, std::size_t) {
+	for ( ; i < end; ++i ) {
+		const std::uint32_t c = p[i];
+		d = utf8_put(d, c <= 0x10FFFF ? c : 0xFFFD);
+	}
+
+	return i;
+}
+
+template<typename CharT>
+void utf8_encode(char *d, const CharT *p, std::size_t n) {
+	std::size_t i = 0;
+#if defined(__YAS_SSE2)
+	constexpr std::size_t block = utf8_block_units(utf_unit_size<sizeof(CharT)>{});
+	while ( i + block <= n ) {
+		if ( utf8_ascii_narrow(d, p + i) ) {
+			d += block;
+			i += block;
+		} else {
+			i = utf8_encode_units(d, p, i, i + block, n);
+		}
+	}
+#endif // __YAS_SSE2
+
+	utf8_encode_units(d, p, i, n, n);
+}
+
+/***************************************************************************/
+
+// the number of the code units of the decoded string.
+// the lead bytes are counted, the 4-byte sequences take two UTF-16 units.
+inline std::size_t utf8_decoded_size(const unsigned char *p, std::size_t n, utf_unit_size<2>) {
+	std::size_t size = 0;
+	for ( std::size_t i = 0; i < n; ++i ) {
+		size += ((p[i] & 0xC0) != 0x80) + (p[i] >= 0xF0);
+	}
+
+	return size;
+}
+
+inline std::size_t utf8_decoded_size(const unsigned char *p, std::size_t n, utf_unit_size<4>) {
+	std::size_t size = 0;
+	for ( std::size_t i = 0; i < n; ++i ) {
+		size += (p[i] & 0xC0) != 0x80;
+	}
+
+	return size;
+}
+
+inline void utf8_put_unit(char16_t *&d, std::uint32_t c) {
+	if ( c >= 0x10000 ) {
+		c -= 0x10000;
+		*d++ = __YAS_SCAST(char16_t, 0xD800 + (c >> 10));
+		*d++ = __YAS_SCAST(char16_t, 0xDC00 + (c & 0x3FF));
+	} else {
+		*d++ = __YAS_SCAST(char16_t, c);
+	}
+}
+
+inline void utf8_put_unit(char32_t *&d, std::uint32_t c) {
+	*d++ = c;
+}
+
+inline bool utf8_is_cont(unsigned char b) { return (b & 0xC0) == 0x80; }
+
+// decodes one sequence starting at 'p[i]', returns the index of the next one
+template<typename CharT>
+std::size_t utf8_decode_one(CharT *&d, const unsigned char *p, std::size_t i, std::size_t n) {
+	const std::uint32_t b0 = p[i];
+	if ( b0 < 0x80 ) {
+		*d++ = __YAS_SCAST(CharT, b0);
+		return i + 1;
+	}
+
+	if ( b0 >= 0xC2 && b0 <= 0xDF ) {
+		if ( i + 1 >= n || !utf8_is_cont(p[i+1]) ) {
+			__YAS_THROW_INVALID_UTF8();
+		}
+		*d++ = __YAS_SCAST(CharT, ((b0 & 0x1F) << 6) | (p[i+1] & 0x3F));
+		return i + 2;
+	}
+
+	if ( b0 >= 0xE0 && b0 <= 0xEF ) {
+		// 0xED 0xA0..0xBF are the surrogates, they are accepted for the WTF-8 round trip
+		if ( i + 2 >= n || !utf8_is_cont(p[i+1]) || !utf8_is_cont(p[i+2])
+			|| (b0 == 0xE0 && p[i+1] < 0xA0) )
+		{
+			__YAS_THROW_INVALID_UTF8();
+		}
+		*d++ = __YAS_SCAST(CharT, ((b0 & 0x0F) << 12) | ((p[i+1] & 0x3Fu) << 6) | (p[i+2] & 0x3F));
+		return i + 3;
+	}
+
+	if ( b0 >= 0xF0 && b0 <= 0xF4 ) {
+		if ( i + 3 >= n || !utf8_is_cont(p[i+1]) || !utf8_is_cont(p[i+2]) || !utf8_is_cont(p[i+3])
+			|| (b0 == 0xF0 && p[i+1] < 0x90) || (b0 == 0xF4 && p[i+1] > 0x8F) )
+		{
+			__YAS_THROW_INVALID_UTF8();
+		}
+		const std::uint32_t c = ((b0 & 0x07) << 18) | ((p[i+1] & 0x3Fu) << 12)
+			| ((p[i+2] & 0x3Fu) << 6) | (p[i+3] & 0x3F);
+		utf8_put_unit(d, c);
+		return i + 4;
+	}
+
+	__YAS_THROW_INVALID_UTF8();
+}
+
+template<typename CharT>
+void utf8_decode(CharT *d, const unsigned char *p, std::size_t n) {
+	std::size_t i = 0;
+#if defined(__YAS_SSE2)
+	constexpr std::size_t block = utf8_block_units(utf_unit_size<sizeof(CharT)>{});
+	while ( i + block <= n ) {
+		if ( utf8_ascii_widen(d, p + i) ) {
+			d += block;
+			i += block;
+		} else {
+			for ( const std::size_t end = i + block; i < end; ) {
+				i = utf8_decode_one(d, p, i, n);
+			}
+		}
+	}
+#endif // __YAS_SSE2
+
+	while ( i < n ) {
+		i = utf8_decode_one(d, p, i, n);
+	}
+}
+
+/***************************************************************************/
+
+// the units of wchar_t/char16_t viewed as the fixed width char types
+template<std::size_t N>
+struct utf_unit_type;
+template<>
+struct utf_unit_type<2> { using type = char16_t; };
+template<>
+struct utf_unit_type<4> { using type = char32_t; };
+
+template<typename D, typename S>
+void to_utf8(D &dst, const S &src) {
+	using unit_type = typename utf_unit_type<sizeof(typename S::value_type)>::type;
+	const unit_type *p = __YAS_RCAST(const unit_type *, src.data());
+	const std::size_t n = src.size();
+
+	dst.resize(utf8_encoded_size(p, n, utf_unit_size<sizeof(unit_type)>{}));
+	if ( !dst.empty() ) {
+		utf8_encode(&dst[0], p, n);
 	}
 }
 
 template<typename D, typename S>
 void from_utf8(D &dst, const S &src) {
-	std::wstring::value_type tmp = 0;
-	for ( auto it = src.begin(); it != src.end(); ++it ) {
-		unsigned char nchar = __YAS_SCAST(unsigned char, *it);
-		if (nchar <= 0x7F) {
-			tmp = nchar;
-		} else if ((nchar & 0xE0) == 0xC0) {
-			tmp = (nchar & 0x1F) << 6;
-			nchar = __YAS_SCAST(unsigned char, *(++it));
-			tmp |= nchar & 0x3F;
-		} else if ((nchar & 0xF0) == 0xE0) {
-			tmp = (nchar & 0x0F) << 12;
-			nchar = __YAS_SCAST(unsigned char, *(++it));
-			tmp |= (nchar & 0x3F) << 6;
-			nchar = __YAS_SCAST(unsigned char, *(++it));
-			tmp |= (nchar & 0x3F);
-		} else if ((nchar & 0xF8) == 0xF0) {
-			tmp = (nchar & 0x0F) << 18;
-			nchar = __YAS_SCAST(unsigned char, *(++it));
-			tmp |= (nchar & 0x3F) << 12;
-			nchar = __YAS_SCAST(unsigned char, *(++it));
-			tmp |= (nchar & 0x3F) << 6;
-			nchar = __YAS_SCAST(unsigned char, *(++it));
-			tmp |= (nchar & 0x3F);
+	using unit_type = typename utf_unit_type<sizeof(typename D::value_type)>::type;
+	const unsigned char *p = __YAS_RCAST(const unsigned char *, src.data());
+	const std::size_t n = src.size();
+
+	dst.resize(utf8_decoded_size(p, n, utf_unit_size<sizeof(unit_type)>{}));
+	if ( n ) {
+		// nothing but the continuation bytes
+		if ( dst.empty() ) {
+			__YAS_THROW_INVALID_UTF8();
 		}
-		dst += tmp;
+
+		utf8_decode(__YAS_RCAST(unit_type *, &dst[0]), p, n);
 	}
 }
 
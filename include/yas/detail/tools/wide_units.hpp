@@ -0,0 +1,189 @@
+
+// Copyright (c) 2010-2021 niXman (github dot nixman at pm dot me). All
+// rights reserved.
+//
+// This file is part of YAS(https://github.com/niXman/yas) project.
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//
+//
+// Boost Software License - Version 1.0 - August 17th, 2003
+//
+// Permission is hereby granted, free of charge, to any person or organization
+// obtaining a copy of the software and accompanying documentation covered by
+// this license (the "Software") to use, reproduce, display, distribute,
+// execute, and transmit the Software, and to prepare derivative works of the
+// Software, and to permit third-parties to whom the Software is furnished to
+// do so, all subject to the following:
+//
+// The copyright notices in the Software and this entire statement, including
+// the above license grant, this restriction and the following disclaimer,
+// must be included in all copies of the Software, in whole or in part, and
+// all derivative works of the Software, unless such copies or derivative
+// works are solely in the form of machine-executable object code generated by
+// a source language processor.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+// SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+// FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+
+
+#ifndef __yas__detail__tools__wide_units_hpp
+#define __yas__detail__tools__wide_units_hpp
+
+#include <yas/detail/config/config.hpp>
+#include <yas/detail/type_traits/type_traits.hpp>
+#include <yas/detail/tools/cast.hpp>
+
+#include <cstring>
+#include <vector>
+
+namespace yas {
+namespace detail {
+
+/***************************************************************************/
+
+// the wide strings in binary archives with 'yas::raw_wide' are stored without
+// the conversion to UTF-8: the size as '(length << 1) | is_32bit', then the
+// code units in the archive byte order.
+// the units of the other width(wchar_t on the other platform) are converted
+// between UTF-16 and UTF-32 on load.
+template<typename S>
+using wide_unit_type = typename std::remove_const<
+    typename std::remove_pointer<decltype(std::declval<S &>().data())>::type
+>::type;
+
+template<typename Archive, typename CharT>
+void write_wide_units(Archive &ar, const CharT *ptr, std::size_t size, std::false_type) {
+    ar.write(ptr, size * sizeof(CharT));
+}
+template<typename Archive, typename CharT>
+void write_wide_units(Archive &ar, const CharT *ptr, std::size_t size, std::true_type) {
+    ar.write_bswapped(ptr, size);
+}
+
+template<typename Archive, typename CharT>
+void read_wide_units(Archive &ar, CharT *ptr, std::size_t size, std::false_type) {
+    ar.read(ptr, size * sizeof(CharT));
+}
+template<typename Archive, typename CharT>
+void read_wide_units(Archive &ar, CharT *ptr, std::size_t size, std::true_type) {
+    ar.read_bswapped(ptr, size);
+}
+
+template<typename CharT, typename U>
+void put_wide_unit(CharT *p, U u) {
+    static_assert(sizeof(CharT) == sizeof(U), "unexpected code unit size");
+    std::memcpy(p, &u, sizeof(u));
+}
+
+inline bool is_surrogate_pair(const std::vector<std::uint16_t> &units, std::size_t i) {
+    return (units[i] & 0xfc00u) == 0xd800u
+        && i + 1 < units.size()
+        && (units[i + 1] & 0xfc00u) == 0xdc00u
+    ;
+}
+
+// the 16-bit string from the 32-bit units
+template<typename S>
+void utf32_to_utf16(S &str, const std::vector<std::uint32_t> &units) {
+    using unit_type = wide_unit_type<S>;
+
+    std::size_t size = units.size();
+    for ( const auto &it: units ) {
+        size += (it > 0xffffu);
+    }
+    str.resize(size);
+    unit_type *p = __YAS_CCAST(unit_type *, str.data());
+    for ( const auto &it: units ) {
+        if ( it > 0xffffu ) {
+            const std::uint32_t c = it - 0x10000u;
+            put_wide_unit(p++, __YAS_SCAST(std::uint16_t, 0xd800u | ((c >> 10) & 0x3ffu)));
+            put_wide_unit(p++, __YAS_SCAST(std::uint16_t, 0xdc00u | (c & 0x3ffu)));
+        } else {
+            put_wide_unit(p++, __YAS_SCAST(std::uint16_t, it));
+        }
+    }
+}
+
+// the 32-bit string from the 16-bit units, the unpaired surrogates are kept as is
+template<typename S>
+void utf16_to_utf32(S &str, const std::vector<std::uint16_t> &units) {
+    using unit_type = wide_unit_type<S>;
+
+    std::size_t size = 0;
+    for ( std::size_t i = 0; i < units.size(); ++i, ++size ) {
+        i += is_surrogate_pair(units, i);
+    }
+    str.resize(size);
+    unit_type *p = __YAS_CCAST(unit_type *, str.data());
+    for ( std::size_t i = 0; i < units.size(); ++i ) {
+        std::uint32_t c = units[i];
+        if ( is_surrogate_pair(units, i) ) {
+            c = 0x10000u + (((c & 0x3ffu) << 10) | (units[i + 1] & 0x3ffu));
+            ++i;
+        }
+        put_wide_unit(p++, c);
+    }
+}
+
+template<typename Archive, typename S, typename BSwap>
+void load_other_wide_units(Archive &ar, S &str, std::size_t size, BSwap, std::true_type /*is_32bit*/) {
+    std::vector<std::uint16_t> units(size);
+    if ( size ) {
+        read_wide_units(ar, units.data(), size, BSwap{});
+    }
+    utf16_to_utf32(str, units);
+}
+template<typename Archive, typename S, typename BSwap>
+void load_other_wide_units(Archive &ar, S &str, std::size_t size, BSwap, std::false_type /*is_32bit*/) {
+    std::vector<std::uint32_t> units(size);
+    if ( size ) {
+        read_wide_units(ar, units.data(), size, BSwap{});
+    }
+    utf32_to_utf16(str, units);
+}
+
+/***************************************************************************/
+
+template<std::size_t F, typename Archive, typename CharT>
+void save_wide_units(Archive &ar, const CharT *ptr, std::size_t size) {
+    static_assert(sizeof(CharT) == 2 || sizeof(CharT) == 4, "unexpected code unit size");
+
+    ar.write_seq_size((size << 1) | (sizeof(CharT) == 4 ? 1u : 0u));
+    if ( size ) {
+        write_wide_units(ar, ptr, size, std::integral_constant<bool, __YAS_BSWAP_NEEDED(F)>{});
+    }
+}
+
+template<std::size_t F, typename Archive, typename S>
+void load_wide_units(Archive &ar, S &str) {
+    using unit_type = wide_unit_type<S>;
+    static_assert(sizeof(unit_type) == 2 || sizeof(unit_type) == 4, "unexpected code unit size");
+    using bswap = std::integral_constant<bool, __YAS_BSWAP_NEEDED(F)>;
+    using is_32bit = std::integral_constant<bool, sizeof(unit_type) == 4>;
+
+    const std::size_t tag = ar.read_seq_size();
+    const std::size_t size = tag >> 1;
+    if ( ((tag & 1u) != 0) == is_32bit::value ) {
+        str.resize(size);
+        if ( size ) {
+            read_wide_units(ar, __YAS_CCAST(unit_type *, str.data()), size, bswap{});
+        }
+    } else {
+        load_other_wide_units(ar, str, size, bswap{}, is_32bit{});
+    }
+}
+
+/***************************************************************************/
+
+} // ns detail
+} // ns yas
+
+#endif // __yas__detail__tools__wide_units_hpp
@@ -54,6 +54,10 @@ enum options: std::uint32_t {
     ,compacted = 1u<<7
     ,mem       = 1u<<8
     ,file      = 1u<<9
+    ,interned  = 1u<<10
+    ,raw_wide  = 1u<<11
+    ,int_blocks = 1u<<12
+    ,packed_bools = 1u<<13
 };
 
 template<typename Ar>
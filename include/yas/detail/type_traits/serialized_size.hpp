@@ -0,0 +1,193 @@
+
+// Copyright (c) 2010-2021 niXman (github dot nixman at pm dot me). All
+// rights reserved.
+//
+// This file is part of YAS(https://github.com/niXman/yas) project.
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//
+//
+// Boost Software License - Version 1.0 - August 17th, 2003
+//
+// Permission is hereby granted, free of charge, to any person or organization
+// obtaining a copy of the software and accompanying documentation covered by
+// this license (the "Software") to use, reproduce, display, distribute,
+// execute, and transmit the Software, and to prepare derivative works of the
+// Software, and to permit third-parties to whom the Software is furnished to
+// do so, all subject to the following:
+//
+// The copyright notices in the Software and this entire statement, including
+// the above license grant, this restriction and the following disclaimer,
+// must be included in all copies of the Software, in whole or in part, and
+// all derivative works of the Software, unless such copies or derivative
+// works are solely in the form of machine-executable object code generated by
+// a source language processor.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+// SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+// FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+
+#ifndef __yas__detail__type_traits__serialized_size_hpp
+#define __yas__detail__type_traits__serialized_size_hpp
+
+#include <yas/detail/type_traits/type_traits.hpp>
+#include <yas/detail/tools/cast.hpp>
+
+#include <cstdint>
+#include <type_traits>
+
+namespace yas {
+namespace detail {
+
+/***************************************************************************/
+
+// the size properties of the serialized representation of some type:
+// 'bounded' - the size is limited by 'value' bytes at compile time,
+// 'exact'   - every value of the type takes exactly 'value' bytes.
+template<bool Bounded, bool Exact, std::size_t Size>
+struct serialized_size_props: std::integral_constant<std::size_t, Bounded ? Size : 0> {
+    static constexpr bool bounded = Bounded;
+    static constexpr bool exact = Bounded && Exact;
+};
+
+template<bool Bounded, bool Exact, std::size_t Size>
+constexpr bool serialized_size_props<Bounded, Exact, Size>::bounded;
+template<bool Bounded, bool Exact, std::size_t Size>
+constexpr bool serialized_size_props<Bounded, Exact, Size>::exact;
+
+using unbounded_serialized_size = serialized_size_props<false, false, 0>;
+
+template<std::size_t Size>
+using exact_serialized_size = serialized_size_props<true, true, Size>;
+
+template<std::size_t Size>
+using max_serialized_size_of = serialized_size_props<true, false, Size>;
+
+// specialized for each type whose size can be known at compile time.
+// currently used for binary archives only.
+template<std::size_t F, typename T, typename = void>
+struct serialized_size_traits: unbounded_serialized_size
+{};
+
+/***************************************************************************/
+
+template<std::size_t F, typename... Types>
+struct serialized_size_sum;
+
+template<std::size_t F>
+struct serialized_size_sum<F>: exact_serialized_size<0>
+{};
+
+template<std::size_t F, typename T, typename... Types>
+struct serialized_size_sum<F, T, Types...>: serialized_size_props<
+     serialized_size_traits<F, T>::bounded && serialized_size_sum<F, Types...>::bounded
+    ,serialized_size_traits<F, T>::exact && serialized_size_sum<F, Types...>::exact
+    ,serialized_size_traits<F, T>::value + serialized_size_sum<F, Types...>::value
+>
+{};
+
+/***************************************************************************/
+
+// the number of bytes used by 'write_seq_size()' for the size known at compile time
+constexpr std::size_t compacted_storage_size(std::uint64_t v) {
+    return (v < (1ull<<32))
+        ? (v < (1u<<16) )
+            ? ((v < (1u<<8 )) ? 1u : 2u)
+            : ((v < (1u<<24)) ? 3u : 4u)
+        : (v < (1ull<<48) )
+            ? ((v < (1ull<<40)) ? 5u : 6u)
+            : ((v < (1ull<<56)) ? 7u : 8u)
+    ;
+}
+
+template<std::size_t F, std::size_t N>
+struct seq_size_storage: std::integral_constant<std::size_t,
+    (F & yas::compacted)
+        ? ((N < (1u<<7)) ? 1u : 1u + compacted_storage_size(N))
+        : sizeof(std::uint64_t)
+>
+{};
+
+// for std::array<T, N>, T[N] and the like
+template<std::size_t F, typename T, std::size_t N>
+struct serialized_size_const_array: serialized_size_props<
+     serialized_size_traits<F, T>::bounded
+    ,serialized_size_traits<F, T>::exact
+    ,seq_size_storage<F, N>::value + N * serialized_size_traits<F, T>::value
+>
+{};
+
+/***************************************************************************/
+
+template<std::size_t F, typename T>
+struct serialized_size_traits<
+     F
+    ,T
+    ,typename std::enable_if<(F & yas::binary) && std::is_fundamental<T>::value>::type
+>: std::conditional<
+     is_any_of<T, char, signed char, unsigned char, bool>::value
+    ,exact_serialized_size<1>
+    ,typename std::conditional<
+         is_signed_integer<T>::value || is_unsigned_integer<T>::value
+        ,typename std::conditional<
+             __YAS_SCAST(bool, F & yas::compacted)
+            ,max_serialized_size_of<1+sizeof(T)>
+            ,exact_serialized_size<sizeof(T)>
+        >::type
+        ,typename std::conditional<
+             is_any_of<T, float, double>::value
+            ,exact_serialized_size<sizeof(T)>
+            ,unbounded_serialized_size
+        >::type
+    >::type
+>::type
+{};
+
+template<std::size_t F, typename T>
+struct serialized_size_traits<
+     F
+    ,T
+    ,typename std::enable_if<(F & yas::binary) && std::is_enum<T>::value>::type
+>: std::conditional<
+     can_be_processed_as_byte_array<F, T>::value
+    ,exact_serialized_size<1+sizeof(T)>
+    ,serialized_size_traits<F, typename std::underlying_type<T>::type>
+>::type
+{};
+
+template<std::size_t F, typename T, std::size_t N>
+struct serialized_size_traits<F, T[N]>
+    :serialized_size_const_array<F, T, N>
+{};
+
+/***************************************************************************/
+
+// the streams which only counts the bytes written
+template<typename OS>
+struct is_count_stream: std::false_type
+{};
+
+// the elements whose size is exactly known can be counted without traversing
+template<std::size_t F, typename Archive, typename T>
+struct can_be_counted_in_bulk: std::integral_constant<bool,
+    is_count_stream<typename Archive::stream_type>::value && serialized_size_traits<F, T>::exact
+>
+{};
+
+template<std::size_t F, typename T, typename Archive>
+void count_in_bulk(Archive &ar, std::size_t elements) {
+    ar.write(__YAS_SCAST(const char *, nullptr), elements * serialized_size_traits<F, T>::value);
+}
+
+/***************************************************************************/
+
+} // ns detail
+} // ns yas
+
+#endif // __yas__detail__type_traits__serialized_size_hpp
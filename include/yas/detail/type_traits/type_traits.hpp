@@ -43,12 +43,32 @@
 #include <yas/detail/type_traits/has_function_serialize.hpp>
 #include <yas/version.hpp>
 
+#include <cstddef>
 #include <cstdint>
 #include <type_traits>
 
 namespace yas {
+
+/***************************************************************************/
+
+// the user types which are stored by memcpy() in the host endian
+// non-compacted binary archives. is specialized by YAS_TRIVIAL().
+template<typename T>
+struct is_memcpy_serializable: std::false_type {};
+
 namespace detail {
 
+// true if the members with the given offsets and sizes follow each other
+// without gaps and cover the whole type
+constexpr bool is_packed_layout(std::size_t total, std::size_t pos) {
+    return pos == total;
+}
+
+template<typename... Tail>
+constexpr bool is_packed_layout(std::size_t total, std::size_t pos, std::size_t off, std::size_t size, Tail... tail) {
+    return off == pos && is_packed_layout(total, pos + size, tail...);
+}
+
 /***************************************************************************/
 
 #if __cplusplus >= 201703L
@@ -249,13 +269,111 @@ struct can_be_processed_as_byte_array: std::integral_constant<bool,
     (is_any_of<T, char, signed char, unsigned char>::value) || // text/json
     ((F & yas::binary) && Integral && sizeof(T) == 1) ||
     ((F & yas::binary) && Integral && (!(F & yas::compacted) && (!__YAS_BSWAP_NEEDED(F)))) ||
-    ((F & yas::binary) && Float && (!(F & yas::compacted) && (!__YAS_BSWAP_NEEDED(F))))
+    ((F & yas::binary) && Float && (!(F & yas::compacted) && (!__YAS_BSWAP_NEEDED(F)))) ||
+    ((F & yas::binary) && is_memcpy_serializable<T>::value && (!(F & yas::compacted) && (!__YAS_BSWAP_NEEDED(F))))
+>
+{};
+
+// the arrays of 16/32/64-bit fundamentals in non-host endian archives,
+// which are byte-swapped in bulk
+template<std::size_t F, typename T>
+struct can_be_processed_as_bswapped_array: std::integral_constant<bool,
+    (F & yas::binary) && !(F & yas::compacted) && __YAS_BSWAP_NEEDED(F) &&
+    (sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8) &&
+    ((std::is_integral<T>::value && !std::is_same<T, bool>::value) || is_any_of<T, float, double>::value)
+>
+{};
+
+// the tag for dispatching the arrays processing
+struct bswapped_array {};
+
+// the arrays of 16/32/64-bit integers in compacted archives with 'yas::int_blocks',
+// which are encoded by the blocks
+template<std::size_t F, typename T>
+struct can_be_processed_as_int_block: std::integral_constant<bool,
+    (F & yas::binary) && (F & yas::compacted) && (F & yas::int_blocks) &&
+    (is_signed_integer<T>::value || is_unsigned_integer<T>::value) &&
+    (sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8)
+>
+{};
+
+// the tag for dispatching the arrays processing
+struct int_block_array {};
+
+// the fixed-size fundamentals, the runs of which are written and read
+// by one call
+template<std::size_t F, typename T>
+struct can_be_fused: std::integral_constant<bool,
+    (F & yas::binary) && !(F & yas::compacted) &&
+    (std::is_integral<T>::value || is_any_of<T, float, double>::value)
 >
 {};
 
+// the number and the total size of the leading fusable types
+template<std::size_t F, typename... Ts>
+struct fused_run {
+    static constexpr std::size_t length = 0;
+    static constexpr std::size_t size = 0;
+};
+
+template<std::size_t F, typename T, typename... Ts>
+struct fused_run<F, T, Ts...> {
+    using tail = fused_run<F, Ts...>;
+    static constexpr std::size_t length = can_be_fused<F, T>::value ? 1 + tail::length : 0;
+    static constexpr std::size_t size = can_be_fused<F, T>::value ? sizeof(T) + tail::size : 0;
+};
+
+// the same for the types starting from I
+template<std::size_t F, std::size_t I, typename... Ts>
+struct fused_run_from: fused_run<F> {};
+
+template<std::size_t F, std::size_t I, typename T, typename... Ts>
+struct fused_run_from<F, I, T, Ts...>: std::conditional<
+     I == 0
+    ,fused_run<F, T, Ts...>
+    ,fused_run_from<F, I - 1, Ts...>
+>::type
+{};
+
 template<typename...>
 using void_t = void;
 
+template<typename C, typename = void>
+struct has_mapped_type: std::false_type {};
+
+template<typename C>
+struct has_mapped_type<C, void_t<typename C::mapped_type>>: std::true_type {};
+
+// the streams with the contiguous memory can show the unread data
+template<typename S, typename = void>
+struct has_intrusive_buffer: std::false_type {};
+
+template<typename S>
+struct has_intrusive_buffer<S, void_t<decltype(std::declval<const S &>().get_intrusive_buffer())>>
+    :std::true_type
+{};
+
+// ...and can move forward without the copying
+template<typename S, typename = void>
+struct has_skip: std::false_type {};
+
+template<typename S>
+struct has_skip<S, void_t<decltype(std::declval<S &>().skip(std::size_t()))>>
+    :std::true_type
+{};
+
+// the containers which are filled through 'resize()' and 'data()'
+template<typename C, typename = void>
+struct is_resizable_contiguous: std::false_type {};
+
+template<typename C>
+struct is_resizable_contiguous<C, void_t<
+     decltype(std::declval<C &>().resize(std::size_t()))
+    ,decltype(std::declval<C &>().data())
+>>
+    :std::true_type
+{};
+
 } // ns detail
 
 template<typename Ar, typename T, typename = void>
@@ -0,0 +1,117 @@
+
+// Copyright (c) 2010-2021 niXman (github dot nixman at pm dot me). All
+// rights reserved.
+//
+// This file is part of YAS(https://github.com/niXman/yas) project.
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//
+//
+// Boost Software License - Version 1.0 - August 17th, 2003
+//
+// Permission is hereby granted, free of charge, to any person or organization
+// obtaining a copy of the software and accompanying documentation covered by
+// this license (the "Software") to use, reproduce, display, distribute,
+// execute, and transmit the Software, and to prepare derivative works of the
+// Software, and to permit third-parties to whom the Software is furnished to
+// do so, all subject to the following:
+//
+// The copyright notices in the Software and this entire statement, including
+// the above license grant, this restriction and the following disclaimer,
+// must be included in all copies of the Software, in whole or in part, and
+// all derivative works of the Software, unless such copies or derivative
+// works are solely in the form of machine-executable object code generated by
+// a source language processor.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+// SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+// FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+
+
+#ifndef __yas__fast_traits_hpp
+#define __yas__fast_traits_hpp
+
+#include <yas/detail/config/config.hpp>
+#include <yas/detail/tools/cast.hpp>
+#include <yas/detail/tools/fast_itoa.hpp>
+#include <yas/detail/io/serialization_exceptions.hpp>
+#include <yas/defaul_traits.hpp>
+
+#include <cstdint>
+#include <limits>
+
+namespace yas {
+
+/***************************************************************************/
+
+// The default traits of the text and json archives. The integers are written
+// two digits per multiplication and are read eight digits at a time, the
+// malformed and the out of range numbers are rejected. The floating point
+// conversions are the ones of default_traits.
+struct fast_traits: default_traits {
+    template<typename T>
+    static T atou(const char *str, std::size_t size);
+    template<typename T>
+    static T atoi(const char *str, std::size_t size);
+
+    template<typename T>
+    static std::size_t utoa(char *buf, const std::size_t bufsize, T v);
+    template<typename T>
+    static std::size_t itoa(char *buf, const std::size_t bufsize, T v);
+}; // struct fast_traits
+
+/***************************************************************************/
+
+template<typename T>
+T fast_traits::atou(const char *str, std::size_t size) {
+    std::uint64_t v = 0;
+    if ( !detail::fast_atou(str, size, v) || v > (std::numeric_limits<T>::max)() ) {
+        __YAS_THROW_INVALID_NUMBER();
+    }
+
+    return __YAS_SCAST(T, v);
+}
+
+template<typename T>
+T fast_traits::atoi(const char *str, std::size_t size) {
+    const bool neg = size && *str == '-';
+    std::uint64_t v = 0;
+    if ( !detail::fast_atou(str + neg, size - neg, v) ) {
+        __YAS_THROW_INVALID_NUMBER();
+    }
+
+    const std::uint64_t limit = __YAS_SCAST(std::uint64_t, (std::numeric_limits<T>::max)()) + neg;
+    if ( v > limit ) {
+        __YAS_THROW_INVALID_NUMBER();
+    }
+
+    // the minimum of T has no positive counterpart
+    return (neg && v)
+        ? __YAS_SCAST(T, -__YAS_SCAST(std::int64_t, v - 1) - 1)
+        : __YAS_SCAST(T, v)
+    ;
+}
+
+/***************************************************************************/
+
+template<typename T>
+std::size_t fast_traits::utoa(char *buf, const std::size_t, T v) {
+    return detail::fast_utoa(buf, __YAS_SCAST(std::uint64_t, v)) - buf;
+}
+
+template<typename T>
+std::size_t fast_traits::itoa(char *buf, const std::size_t, T v) {
+    return detail::fast_itoa(buf, __YAS_SCAST(std::int64_t, v)) - buf;
+}
+
+/***************************************************************************/
+
+} // ns yas
+
+#endif // __yas__fast_traits_hpp
@@ -68,8 +68,8 @@ struct get_output_archive {
         ,yas::binary_oarchive<stream_type, WI>
         ,typename std::conditional<
             ((F & yas::text) > 0)
-            ,yas::text_oarchive<stream_type, WI, default_traits>
-            ,yas::json_oarchive<stream_type, WI, default_traits>
+            ,yas::text_oarchive<stream_type, WI, fast_traits>
+            ,yas::json_oarchive<stream_type, WI, fast_traits>
         >::type
     >::type;
 };
@@ -89,8 +89,8 @@ struct get_input_archive {
         ,yas::binary_iarchive<stream_type, WI>
         ,typename std::conditional<
             ((F & yas::text) > 0)
-            ,yas::text_iarchive<stream_type, WI, default_traits>
-            ,yas::json_iarchive<stream_type, WI, default_traits>
+            ,yas::text_iarchive<stream_type, WI, fast_traits>
+            ,yas::json_iarchive<stream_type, WI, fast_traits>
         >::type
     >::type;
 };
@@ -43,7 +43,7 @@
 #include <yas/detail/tools/base_object.hpp>
 #include <yas/detail/tools/noncopyable.hpp>
 #include <yas/detail/tools/limit.hpp>
-#include <yas/defaul_traits.hpp>
+#include <yas/fast_traits.hpp>
 
 #include <yas/types/utility/fundamental.hpp>
 #include <yas/types/utility/enum.hpp>
@@ -54,6 +54,15 @@
 #include <yas/types/utility/object.hpp>
 #include <yas/types/utility/asis.hpp>
 #include <yas/types/utility/init.hpp>
+#include <yas/types/utility/delta.hpp>
+#include <yas/types/utility/timeseries.hpp>
+#include <yas/types/utility/columnar.hpp>
+#include <yas/types/utility/presence.hpp>
+#include <yas/types/utility/narrow.hpp>
+#include <yas/types/utility/quantize.hpp>
+#include <yas/types/utility/rle.hpp>
+#include <yas/types/utility/sparse.hpp>
+#include <yas/types/utility/string_table.hpp>
 
 #include <yas/buffers.hpp>
 #include <yas/object.hpp>
@@ -63,7 +72,7 @@ namespace yas {
 
 /***************************************************************************/
 
-template<typename OS, std::size_t F = json|ehost, typename Trait = yas::default_traits>
+template<typename OS, std::size_t F = json|ehost, typename Trait = yas::fast_traits>
 struct json_oarchive
     :detail::json_ostream<OS, F, Trait>
     ,detail::oarchive_header<F>
@@ -54,7 +54,9 @@ struct mem_ostream {
     YAS_NONCOPYABLE(mem_ostream)
     YAS_MOVABLE(mem_ostream)
 
-    mem_ostream(std::size_t reserved = 1024*20)
+    enum: std::size_t { default_reserved = 1024*20 };
+
+    mem_ostream(std::size_t reserved = default_reserved)
         :buf(reserved)
         ,beg(buf.data.get())
         ,cur(buf.data.get())
@@ -158,6 +160,14 @@ struct mem_istream {
         return avail;
     }
 
+    std::size_t skip(const std::size_t size) {
+        const std::size_t avail = __YAS_SCAST(std::size_t, end-cur);
+        const std::size_t n = size < avail ? size : avail;
+        cur += n;
+
+        return n;
+    }
+
     std::size_t available() const { return end-cur; }
     bool empty() const { return cur == end; }
     char peekch() const { return *cur; }
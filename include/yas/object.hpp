@@ -43,6 +43,7 @@
 #include <yas/detail/tools/ctmap.hpp>
 
 #include <tuple>
+#include <cstddef>
 #include <cstring>
 
 namespace yas {
@@ -375,6 +376,41 @@ make_object(std::nullptr_t, Pairs &&... pairs) {
 
 /***************************************************************************/
 
+#define __YAS_TRIVIAL_GEN_IS_FUNDAMENTAL(unused0, tname, idx, elem) \
+    && std::is_fundamental<decltype(tname::elem)>::value
+
+#define __YAS_TRIVIAL_GEN_LAYOUT(unused0, tname, idx, elem) \
+    ,offsetof(tname, elem), sizeof(tname::elem)
+
+// declares that the arrays of 'tname' can be stored by memcpy() in the host
+// endian non-compacted binary archives. the members must be listed in the
+// declaration order, as they are in serialize(), so both ways produce the
+// same bytes. must be used in the global namespace.
+#define YAS_TRIVIAL(tname, ...) \
+    namespace yas { \
+    template<> \
+    struct is_memcpy_serializable<tname>: std::true_type { \
+        static_assert( \
+             std::is_trivially_copyable<tname>::value \
+            ,"YAS_TRIVIAL: " YAS_PP_STRINGIZE(tname) " is not trivially copyable" \
+        ); \
+        static_assert( \
+             true YAS_PP_SEQ_FOR_EACH_I(__YAS_TRIVIAL_GEN_IS_FUNDAMENTAL, tname, YAS_PP_TUPLE_TO_SEQ((__VA_ARGS__))) \
+            ,"YAS_TRIVIAL: all the members of " YAS_PP_STRINGIZE(tname) " must be fundamental" \
+        ); \
+        static_assert( \
+             ::yas::detail::is_packed_layout( \
+                 sizeof(tname) \
+                ,0 \
+                YAS_PP_SEQ_FOR_EACH_I(__YAS_TRIVIAL_GEN_LAYOUT, tname, YAS_PP_TUPLE_TO_SEQ((__VA_ARGS__))) \
+             ) \
+            ,"YAS_TRIVIAL: " YAS_PP_STRINGIZE(tname) " has padding, or the members are not listed in the declaration order" \
+        ); \
+    }; \
+    }
+
+/***************************************************************************/
+
 #define __YAS_DEFINE_INTRUSIVE_SERIALIZE_AUX(nvp, oname, tname, ...) \
     template<typename Archive> \
     void serialize(Archive &ar, const tname &t) { \
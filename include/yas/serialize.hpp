@@ -46,8 +46,54 @@
 #include <yas/file_streams.hpp>
 #include <yas/std_streams.hpp>
 #include <yas/count_streams.hpp>
+#include <yas/get_archive.hpp>
+#include <yas/detail/type_traits/serialized_size.hpp>
 
 namespace yas {
+namespace detail {
+
+/***************************************************************************/
+
+template<std::size_t F>
+struct serialized_header_size: std::integral_constant<std::size_t,
+    ((F & yas::no_header) || (F & yas::json)) ? 0 : header::k_header_size
+>
+{};
+
+// when the size of all the types is known at compile time - the buffer will be allocated only once
+template<std::size_t F, typename... Types>
+struct mem_ostream_reserve: std::integral_constant<std::size_t,
+    serialized_size_sum<F, typename std::decay<Types>::type...>::bounded
+        ? serialized_header_size<F>::value + serialized_size_sum<F, typename std::decay<Types>::type...>::value
+        : yas::mem_ostream::default_reserved
+>
+{};
+
+template<std::size_t F, typename Archive, typename T>
+std::size_t serialized_size_impl(Archive &, const T &, std::true_type) {
+    return serialized_size_traits<F, T>::value;
+}
+
+template<std::size_t F, typename Archive, typename T>
+std::size_t serialized_size_impl(Archive &ar, const T &v, std::false_type) {
+    ar & v;
+
+    return 0;
+}
+
+template<std::size_t F, typename Archive>
+std::size_t serialized_size(Archive &) { return 0; }
+
+template<std::size_t F, typename Archive, typename Head, typename... Tail>
+std::size_t serialized_size(Archive &ar, const Head &head, const Tail&... tail) {
+    using cond = std::integral_constant<bool, serialized_size_traits<F, Head>::exact>;
+
+    return serialized_size_impl<F>(ar, head, cond{}) + serialized_size<F>(ar, tail...);
+}
+
+/***************************************************************************/
+
+} // ns detail
 
 /***************************************************************************/
 // mem + binary
@@ -58,7 +104,7 @@ typename std::enable_if<
     ,yas::shared_buffer
 >::type
 save(Types &&... args) {
-    yas::mem_ostream os;
+    yas::mem_ostream os(detail::mem_ostream_reserve<(F & (~yas::mem)), Types...>::value);
     yas::binary_oarchive<yas::mem_ostream, (F & (~yas::mem))> oa(os);
     oa(std::forward<Types>(args)...);
 
@@ -301,16 +347,20 @@ save(yas::std_ostream_adapter &os, Types &&... args) {
 /***************************************************************************/
 // byte counter
 
+template<std::size_t F, typename ...Types>
+typename std::enable_if<
+    ((F & yas::binary) > 0)
+    ,std::size_t
+>::type
+serialized_size(const Types &... args);
+
 template<std::size_t F, typename ...Types>
 typename std::enable_if<
     ((F & yas::binary) > 0)
     ,std::size_t
 >::type
 saved_size(Types &&... args) {
-    yas::count_ostream os;
-    yas::binary_oarchive<yas::count_ostream, F> oa(os);
-    oa(std::forward<Types>(args)...);
-    return os.total_size;
+    return serialized_size<F>(args...);
 }
 
 template<std::size_t F, typename ...Types>
@@ -337,6 +387,57 @@ saved_size(Types &&... args) {
     return os.total_size;
 }
 
+/***************************************************************************/
+// compile-time size
+
+// the max size of the archive holding the 'T', including the archive header.
+// available for binary archives and for the types whose size is bounded.
+template<std::size_t F, typename T>
+constexpr std::size_t max_serialized_size() {
+    static_assert(F & yas::binary, "max_serialized_size() is available for binary archives only");
+    static_assert(
+         detail::serialized_size_traits<(F & (~yas::mem)), T>::bounded
+        ,"the serialized size of T is unknown at compile time"
+    );
+
+    return detail::serialized_header_size<F>::value
+        + detail::serialized_size_traits<(F & (~yas::mem)), T>::value;
+}
+
+// the exact size of the archive holding the 'args', including the archive header.
+// the args whose size is exactly known at compile time are not traversed.
+template<std::size_t F, typename ...Types>
+typename std::enable_if<
+    ((F & yas::binary) > 0)
+    ,std::size_t
+>::type
+serialized_size(const Types &... args) {
+    constexpr std::size_t flags = (F & (~yas::mem)) | yas::no_header;
+    yas::count_ostream os;
+    yas::binary_oarchive<yas::count_ostream, flags> oa(os);
+    const std::size_t fixed = detail::serialized_size<flags>(oa, args...);
+
+    return detail::serialized_header_size<F>::value + fixed + os.total_size;
+}
+
+/***************************************************************************/
+// mem, the exact size
+
+// two passes: the first one calculates the exact size of the archive
+// without copying the data, then the buffer is allocated only once.
+template<std::size_t F, typename ...Types>
+typename std::enable_if<
+    ((F & yas::mem) > 0)
+    ,yas::shared_buffer
+>::type
+save_exact(Types &&... args) {
+    yas::mem_ostream os(saved_size<(F & (~yas::mem))>(args...));
+    typename yas::get_output_archive<F>::archive_type oa(os);
+    oa(std::forward<Types>(args)...);
+
+    return os.get_shared_buffer();
+}
+
 /***************************************************************************/
 // mem
 
@@ -299,6 +299,174 @@ inline bool archive_is_compacted(const std::vector<uint8_t>& buf) {
 
 /***************************************************************************/
 
+inline bool archive_is_interned(const detail::header::archive_header &h) {
+    return h.bits.interned;
+}
+
+inline bool archive_is_interned(const yas::intrusive_buffer &buf) {
+    const auto header = read_header(buf);
+
+    return archive_is_interned(header);
+}
+
+inline bool archive_is_interned(const yas::shared_buffer &buf) {
+    const auto header = read_header(buf);
+
+    return archive_is_interned(header);
+}
+
+inline bool archive_is_interned(const char *fname) {
+    const auto header = read_header(fname);
+
+    return archive_is_interned(header);
+}
+
+inline bool archive_is_interned(const std::vector<char>& buf) {
+    const auto header = read_header(buf);
+
+    return archive_is_interned(header);
+}
+
+inline bool archive_is_interned(const std::vector<int8_t>& buf) {
+    const auto header = read_header(buf);
+
+    return archive_is_interned(header);
+}
+
+inline bool archive_is_interned(const std::vector<uint8_t>& buf) {
+    const auto header = read_header(buf);
+
+    return archive_is_interned(header);
+}
+
+/***************************************************************************/
+
+inline bool archive_is_raw_wide(const detail::header::archive_header &h) {
+    return h.bits.raw_wide;
+}
+
+inline bool archive_is_raw_wide(const yas::intrusive_buffer &buf) {
+    const auto header = read_header(buf);
+
+    return archive_is_raw_wide(header);
+}
+
+inline bool archive_is_raw_wide(const yas::shared_buffer &buf) {
+    const auto header = read_header(buf);
+
+    return archive_is_raw_wide(header);
+}
+
+inline bool archive_is_raw_wide(const char *fname) {
+    const auto header = read_header(fname);
+
+    return archive_is_raw_wide(header);
+}
+
+inline bool archive_is_raw_wide(const std::vector<char>& buf) {
+    const auto header = read_header(buf);
+
+    return archive_is_raw_wide(header);
+}
+
+inline bool archive_is_raw_wide(const std::vector<int8_t>& buf) {
+    const auto header = read_header(buf);
+
+    return archive_is_raw_wide(header);
+}
+
+inline bool archive_is_raw_wide(const std::vector<uint8_t>& buf) {
+    const auto header = read_header(buf);
+
+    return archive_is_raw_wide(header);
+}
+
+/***************************************************************************/
+
+inline bool archive_is_int_blocks(const detail::header::archive_header &h) {
+    return h.bits.int_blocks;
+}
+
+inline bool archive_is_int_blocks(const yas::intrusive_buffer &buf) {
+    const auto header = read_header(buf);
+
+    return archive_is_int_blocks(header);
+}
+
+inline bool archive_is_int_blocks(const yas::shared_buffer &buf) {
+    const auto header = read_header(buf);
+
+    return archive_is_int_blocks(header);
+}
+
+inline bool archive_is_int_blocks(const char *fname) {
+    const auto header = read_header(fname);
+
+    return archive_is_int_blocks(header);
+}
+
+inline bool archive_is_int_blocks(const std::vector<char>& buf) {
+    const auto header = read_header(buf);
+
+    return archive_is_int_blocks(header);
+}
+
+inline bool archive_is_int_blocks(const std::vector<int8_t>& buf) {
+    const auto header = read_header(buf);
+
+    return archive_is_int_blocks(header);
+}
+
+inline bool archive_is_int_blocks(const std::vector<uint8_t>& buf) {
+    const auto header = read_header(buf);
+
+    return archive_is_int_blocks(header);
+}
+
+/***************************************************************************/
+
+inline bool archive_is_packed_bools(const detail::header::archive_header &h) {
+    return h.bits.packed_bools;
+}
+
+inline bool archive_is_packed_bools(const yas::intrusive_buffer &buf) {
+    const auto header = read_header(buf);
+
+    return archive_is_packed_bools(header);
+}
+
+inline bool archive_is_packed_bools(const yas::shared_buffer &buf) {
+    const auto header = read_header(buf);
+
+    return archive_is_packed_bools(header);
+}
+
+inline bool archive_is_packed_bools(const char *fname) {
+    const auto header = read_header(fname);
+
+    return archive_is_packed_bools(header);
+}
+
+inline bool archive_is_packed_bools(const std::vector<char>& buf) {
+    const auto header = read_header(buf);
+
+    return archive_is_packed_bools(header);
+}
+
+inline bool archive_is_packed_bools(const std::vector<int8_t>& buf) {
+    const auto header = read_header(buf);
+
+    return archive_is_packed_bools(header);
+}
+
+inline bool archive_is_packed_bools(const std::vector<uint8_t>& buf) {
+    const auto header = read_header(buf);
+
+    return archive_is_packed_bools(header);
+}
+
+/***************************************************************************/
+
 } // namespace yas
 
 #endif // __yas__tools__archinfo_hpp
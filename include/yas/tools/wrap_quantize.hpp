@@ -0,0 +1,146 @@
+
+// Copyright (c) 2010-2021 niXman (github dot nixman at pm dot me). All
+// rights reserved.
+//
+// This file is part of YAS(https://github.com/niXman/yas) project.
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//
+//
+// Boost Software License - Version 1.0 - August 17th, 2003
+//
+// Permission is hereby granted, free of charge, to any person or organization
+// obtaining a copy of the software and accompanying documentation covered by
+// this license (the "Software") to use, reproduce, display, distribute,
+// execute, and transmit the Software, and to prepare derivative works of the
+// Software, and to permit third-parties to whom the Software is furnished to
+// do so, all subject to the following:
+//
+// The copyright notices in the Software and this entire statement, including
+// the above license grant, this restriction and the following disclaimer,
+// must be included in all copies of the Software, in whole or in part, and
+// all derivative works of the Software, unless such copies or derivative
+// works are solely in the form of machine-executable object code generated by
+// a source language processor.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+// SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+// FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+
+
+#ifndef __yas__tools__wrap_quantize_hpp
+#define __yas__tools__wrap_quantize_hpp
+
+#include <yas/detail/type_traits/type_traits.hpp>
+
+namespace yas {
+
+/***************************************************************************/
+
+// the formats of 'yas::quantize()'
+struct f16 {};  // IEEE 754 binary16
+struct bf16 {}; // bfloat16, the upper half of binary32
+
+// the vector of floats is stored in binary archives with the reduced
+// precision of the format Q, the text/json archives are not affected.
+template<typename Q, typename T>
+struct quantize_wrapper {
+    template<typename VT>
+    struct real_value_type {
+        using type = typename std::conditional<
+             std::is_lvalue_reference<VT>::value
+            ,VT
+            ,typename std::decay<VT>::type
+        >::type;
+    };
+    using value_type = typename real_value_type<T>::type;
+
+    static_assert(
+         std::is_same<Q, f16>::value || std::is_same<Q, bf16>::value
+        ,"the format should be yas::f16 or yas::bf16"
+    );
+    static_assert(
+         std::is_same<typename std::decay<T>::type::value_type, float>::value
+        ,"only the containers of floats can be quantized"
+    );
+    static_assert(
+         detail::is_resizable_contiguous<typename std::decay<T>::type>::value
+        ,"only the contiguous containers with resize() and data(), like std::vector, can be quantized"
+    );
+
+    quantize_wrapper(const quantize_wrapper &) = delete;
+    quantize_wrapper& operator=(const quantize_wrapper &) = delete;
+    constexpr quantize_wrapper(T &&v) noexcept
+        :val(std::forward<T>(v))
+    {}
+    constexpr quantize_wrapper(quantize_wrapper &&r) noexcept
+        :val(std::forward<value_type>(r.val))
+    {}
+
+    value_type val;
+};
+
+template<typename Q, typename T>
+quantize_wrapper<Q, T> quantize(T &&val) {
+    return {std::forward<T>(val)};
+}
+
+/***************************************************************************/
+
+// the vector of floats or doubles is stored in binary archives as 32-bit
+// integers of the values multiplied by 'scale', the out of range values
+// are saturated. the text/json archives are not affected. the 'scale'
+// should be positive and finite.
+template<typename T>
+struct fixed_point_wrapper {
+    template<typename VT>
+    struct real_value_type {
+        using type = typename std::conditional<
+             std::is_lvalue_reference<VT>::value
+            ,VT
+            ,typename std::decay<VT>::type
+        >::type;
+    };
+    using value_type = typename real_value_type<T>::type;
+
+    static_assert(
+         std::is_same<typename std::decay<T>::type::value_type, float>::value
+            || std::is_same<typename std::decay<T>::type::value_type, double>::value
+        ,"only the containers of floats or doubles can be stored as fixed point"
+    );
+    static_assert(
+         detail::is_resizable_contiguous<typename std::decay<T>::type>::value
+        ,"only the contiguous containers with resize() and data(), like std::vector, can be stored as fixed point"
+    );
+
+    fixed_point_wrapper(const fixed_point_wrapper &) = delete;
+    fixed_point_wrapper& operator=(const fixed_point_wrapper &) = delete;
+    constexpr fixed_point_wrapper(T &&v, double scale) noexcept
+        :val(std::forward<T>(v))
+        ,scale(scale)
+    {}
+    constexpr fixed_point_wrapper(fixed_point_wrapper &&r) noexcept
+        :val(std::forward<value_type>(r.val))
+        ,scale(r.scale)
+    {}
+
+    value_type val;
+    double scale;
+};
+
+template<typename T>
+fixed_point_wrapper<T> fixed_point(T &&val, double scale) {
+    return {std::forward<T>(val), scale};
+}
+
+/***************************************************************************/
+
+} // namespace yas
+
+#endif // __yas__tools__wrap_quantize_hpp
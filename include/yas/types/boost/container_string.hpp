@@ -41,6 +41,7 @@
 #include <yas/detail/type_traits/serializer.hpp>
 #include <yas/detail/tools/cast.hpp>
 #include <yas/detail/tools/save_load_string.hpp>
+#include <yas/detail/tools/strings_dict.hpp>
 
 #include <boost/container/string.hpp>
 
@@ -63,8 +64,7 @@ struct serializer<
             save_string(ar, string.data(), string.length());
             ar.write("\"", 1);
         } else {
-            ar.write_seq_size(string.length());
-            ar.write(string.data(), string.length());
+            save_string_bytes<F>(ar, string.data(), string.length());
         }
 
         return ar;
@@ -77,9 +77,7 @@ struct serializer<
             load_string(string, ar);
             __YAS_THROW_IF_WRONG_JSON_CHARS(ar, "\"");
         } else {
-            const auto size = ar.read_seq_size();
-            string.resize(size);
-            ar.read(__YAS_CCAST(char*, string.data()), size);
+            load_string_bytes<F>(ar, string);
         }
 
         return ar;
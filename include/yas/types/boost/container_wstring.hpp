@@ -40,6 +40,7 @@
 #include <yas/detail/type_traits/type_traits.hpp>
 #include <yas/detail/type_traits/serializer.hpp>
 #include <yas/detail/tools/utf8conv.hpp>
+#include <yas/detail/tools/wide_units.hpp>
 
 #include <boost/container/string.hpp>
 
@@ -57,19 +58,40 @@ struct serializer<
 > {
 	template<typename Archive>
 	static Archive& save(Archive& ar, const boost::container::wstring& string) {
+		return save(ar, string, std::integral_constant<bool, (F & yas::binary) && (F & yas::raw_wide)>{});
+	}
+
+	template<typename Archive>
+	static Archive& load(Archive& ar, boost::container::wstring& string) {
+		return load(ar, string, std::integral_constant<bool, (F & yas::binary) && (F & yas::raw_wide)>{});
+	}
+
+private:
+	template<typename Archive>
+	static Archive& save(Archive& ar, const boost::container::wstring& string, std::false_type) {
 		boost::container::string dst;
 		detail::TypeConverter<boost::container::string, boost::container::wstring>::Convert(dst, string);
 		ar & dst;
 		return ar;
 	}
+	template<typename Archive>
+	static Archive& save(Archive& ar, const boost::container::wstring& string, std::true_type) {
+		save_wide_units<F>(ar, string.data(), string.size());
+		return ar;
+	}
 
 	template<typename Archive>
-	static Archive& load(Archive& ar, boost::container::wstring& string) {
+	static Archive& load(Archive& ar, boost::container::wstring& string, std::false_type) {
 		boost::container::string src;
 		ar & src;
 		detail::TypeConverter<boost::container::wstring, boost::container::string>::Convert(string, src);
 		return ar;
 	}
+	template<typename Archive>
+	static Archive& load(Archive& ar, boost::container::wstring& string, std::true_type) {
+		load_wide_units<F>(ar, string);
+		return ar;
+	}
 };
 
 /***************************************************************************/
@@ -38,6 +38,7 @@
 
 #include <yas/detail/type_traits/serializer.hpp>
 #include <yas/detail/tools/save_load_string.hpp>
+#include <yas/detail/tools/strings_dict.hpp>
 
 #include <boost/utility/string_view.hpp>
 
@@ -66,8 +67,7 @@ struct serializer<
                 ar.write("\"", 1);
             }
         } else {
-            ar.write_seq_size(str.length());
-            ar.write(str.data(), str.length());
+            save_string_bytes<F>(ar, str.data(), str.length());
         }
 
         return ar;
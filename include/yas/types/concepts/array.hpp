@@ -36,6 +36,9 @@
 #ifndef __yas__types__concepts__array_hpp
 #define __yas__types__concepts__array_hpp
 
+#include <yas/detail/type_traits/serialized_size.hpp>
+#include <yas/detail/tools/packed_bits.hpp>
+
 #include <vector>
 
 namespace yas {
@@ -45,15 +48,59 @@ namespace array {
 
 /***************************************************************************/
 
-template<typename Archive, typename C>
+// selects the save_array()/load_array() overload for the arrays of T
+template<std::size_t F, typename T, bool Contiguous = true>
+using processing_tag = typename std::conditional<
+     can_be_processed_as_bswapped_array<F, T>::value && Contiguous
+    ,bswapped_array
+    ,typename std::conditional<
+         can_be_processed_as_int_block<F, T>::value && Contiguous
+        ,int_block_array
+        ,std::integral_constant<
+             bool
+            ,can_be_processed_as_byte_array<F, T>::value && Contiguous
+        >
+    >::type
+>::type;
+
+/***************************************************************************/
+
+template<std::size_t F, typename Archive, typename C>
 void save_array(Archive &ar, const C &c, std::true_type) {
     ar.write(&c[0], sizeof(typename C::value_type) * c.size());
 }
 
-template<typename Archive, typename C>
+template<std::size_t F, typename Archive, typename C>
+void save_array(Archive &ar, const C &c, bswapped_array) {
+    ar.write_bswapped(&c[0], c.size());
+}
+
+template<std::size_t F, typename Archive, typename C>
+void save_array(Archive &ar, const C &c, int_block_array) {
+    ar.write_int_block(&c[0], c.size());
+}
+
+template<std::size_t F, typename Archive, typename A>
+void save_array(Archive &ar, const std::vector<bool, A> &c, std::false_type) {
+    __YAS_CONSTEXPR_IF ( (F & yas::binary) && (F & yas::packed_bools) ) {
+        save_packed_bits(ar, c, c.size());
+    } else __YAS_CONSTEXPR_IF ( F & yas::binary ) {
+        save_bool_bytes(ar, c, c.size());
+    } else {
+        for ( const auto &it: c ) {
+            ar & it;
+        }
+    }
+}
+
+template<std::size_t F, typename Archive, typename C>
 void save_array(Archive &ar, const C &c, std::false_type) {
-    for ( const auto &it: c ) {
-        ar & it;
+    __YAS_CONSTEXPR_IF ( can_be_counted_in_bulk<F, Archive, typename C::value_type>::value ) {
+        count_in_bulk<F, typename C::value_type>(ar, c.size());
+    } else {
+        for ( const auto &it: c ) {
+            ar & it;
+        }
     }
 }
 
@@ -76,13 +123,10 @@ Archive& save(Archive &ar, const C &c) {
         const auto size = c.size();
         ar.write_seq_size(size);
         if ( size ) {
-            using cond = std::integral_constant<
-                 bool
-                ,can_be_processed_as_byte_array<F, typename C::value_type>::value &&
-                 std::is_same<typename C::value_type&, typename C::reference>::value
-            >;
+            using contiguous = std::is_same<typename C::value_type&, typename C::reference>;
+            using cond = processing_tag<F, typename C::value_type, contiguous::value>;
 
-            save_array(ar, c, cond{});
+            save_array<F>(ar, c, cond{});
         }
     }
 
@@ -96,12 +140,28 @@ void load_array(Archive &ar, C &c, std::true_type) {
     ar.read(&c[0], sizeof(typename C::value_type) * c.size());
 }
 
-template<typename Archive>
-void load_array(Archive &ar, std::vector<bool> &c) {
-    for ( auto it = c.begin(); it != c.end(); ++it ) {
-        typename std::vector<bool>::value_type v{};
-        ar & v;
-        *it = std::move(v);
+template<typename Archive, typename C>
+void load_array(Archive &ar, C &c, bswapped_array) {
+    ar.read_bswapped(&c[0], c.size());
+}
+
+template<typename Archive, typename C>
+void load_array(Archive &ar, C &c, int_block_array) {
+    ar.read_int_block(&c[0], c.size());
+}
+
+template<typename Archive, typename A>
+void load_array(Archive &ar, std::vector<bool, A> &c) {
+    __YAS_CONSTEXPR_IF ( (Archive::flags() & yas::binary) && (Archive::flags() & yas::packed_bools) ) {
+        load_packed_bits(ar, c, c.size());
+    } else __YAS_CONSTEXPR_IF ( Archive::flags() & yas::binary ) {
+        load_bool_bytes(ar, c, c.size());
+    } else {
+        for ( auto it = c.begin(); it != c.end(); ++it ) {
+            typename std::vector<bool, A>::value_type v{};
+            ar & v;
+            *it = std::move(v);
+        }
     }
 }
 
@@ -168,11 +228,8 @@ Archive& load(Archive &ar, C &c) {
         const auto size = ar.read_seq_size();
         if ( size ) {
             c.resize(size);
-            using cond = std::integral_constant<
-                 bool
-                ,can_be_processed_as_byte_array<F, typename C::value_type>::value &&
-                 std::is_same<typename C::value_type&, typename C::reference>::value
-            >;
+            using contiguous = std::is_same<typename C::value_type&, typename C::reference>;
+            using cond = processing_tag<F, typename C::value_type, contiguous::value>;
 
             load_array(ar, c, cond{});
         }
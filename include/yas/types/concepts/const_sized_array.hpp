@@ -36,6 +36,8 @@
 #ifndef __yas__types__concepts__const_sized_array_hpp
 #define __yas__types__concepts__const_sized_array_hpp
 
+#include <yas/detail/type_traits/serialized_size.hpp>
+
 namespace yas {
 namespace detail {
 namespace concepts {
@@ -67,19 +69,49 @@ Archive& save_chars(Archive &ar, const T *beg, const T *end, __YAS_DISABLE_IF_IS
     return ar;
 }
 
+template<std::size_t N, std::size_t F, typename Archive, typename T>
+void save_elements(Archive &ar, const T *beg, const T *, bswapped_array) {
+    ar.write_bswapped(beg, N);
+}
+
+template<std::size_t N, std::size_t F, typename Archive, typename T>
+void save_elements(Archive &ar, const T *beg, const T *, int_block_array) {
+    ar.write_int_block(beg, N);
+}
+
+template<std::size_t N, std::size_t F, typename Archive, typename T>
+void save_elements(Archive &ar, const T *beg, const T *, std::true_type) {
+    ar.write(beg, sizeof(T) * N);
+}
+
+template<std::size_t N, std::size_t F, typename Archive, typename T>
+void save_elements(Archive &ar, const T *beg, const T *end, std::false_type) {
+    if ( can_be_counted_in_bulk<F, Archive, T>::value ) {
+        count_in_bulk<F, T>(ar, N);
+    } else {
+        for ( ; beg != end; ++beg ) {
+            ar & (*beg);
+        }
+    }
+}
+
 template<std::size_t N, std::size_t F, typename Archive, typename T>
 Archive& save(Archive &ar, const T *beg, const T *end) {
     if ( F & yas::json ) {
         return save_chars<N, F>(ar, beg, end);
     } else {
         ar.write_seq_size(N);
-        if ( can_be_processed_as_byte_array<F, T>::value ) {
-            ar.write(beg, sizeof(T) * N);
-        } else {
-            for ( ; beg != end; ++beg ) {
-                ar & (*beg);
-            }
-        }
+        using cond = typename std::conditional<
+             can_be_processed_as_bswapped_array<F, T>::value
+            ,bswapped_array
+            ,typename std::conditional<
+                 can_be_processed_as_int_block<F, T>::value
+                ,int_block_array
+                ,std::integral_constant<bool, can_be_processed_as_byte_array<F, T>::value>
+            >::type
+        >::type;
+
+        save_elements<N, F>(ar, beg, end, cond{});
     }
 
     return ar;
@@ -140,6 +172,28 @@ Archive& load_chars(Archive &ar, T *beg, T *end, __YAS_DISABLE_IF_IS_ANY_OF(T, c
     return ar;
 }
 
+template<std::size_t N, std::size_t F, typename Archive, typename T>
+void load_elements(Archive &ar, T *beg, T *, bswapped_array) {
+    ar.read_bswapped(beg, N);
+}
+
+template<std::size_t N, std::size_t F, typename Archive, typename T>
+void load_elements(Archive &ar, T *beg, T *, int_block_array) {
+    ar.read_int_block(beg, N);
+}
+
+template<std::size_t N, std::size_t F, typename Archive, typename T>
+void load_elements(Archive &ar, T *beg, T *, std::true_type) {
+    ar.read(beg, sizeof(T) * N);
+}
+
+template<std::size_t N, std::size_t F, typename Archive, typename T>
+void load_elements(Archive &ar, T *beg, T *end, std::false_type) {
+    for ( ; beg != end; ++beg ) {
+        ar & (*beg);
+    }
+}
+
 template<std::size_t N, std::size_t F, typename Archive, typename T>
 Archive& load(Archive &ar, T *beg, T *end) {
     if ( F & yas::json ) {
@@ -149,13 +203,17 @@ Archive& load(Archive &ar, T *beg, T *end) {
         if ( size != N ) {
             __YAS_THROW_WRONG_ARRAY_SIZE();
         }
-        if ( can_be_processed_as_byte_array<F, T>::value ) {
-            ar.read(beg, sizeof(T) * N);
-        } else {
-            for ( ; beg != end; ++beg ) {
-                ar & (*beg);
-            }
-        }
+        using cond = typename std::conditional<
+             can_be_processed_as_bswapped_array<F, T>::value
+            ,bswapped_array
+            ,typename std::conditional<
+                 can_be_processed_as_int_block<F, T>::value
+                ,int_block_array
+                ,std::integral_constant<bool, can_be_processed_as_byte_array<F, T>::value>
+            >::type
+        >::type;
+
+        load_elements<N, F>(ar, beg, end, cond{});
     }
 
     return ar;
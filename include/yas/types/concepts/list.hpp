@@ -36,6 +36,8 @@
 #ifndef __yas__types__concepts__list_hpp
 #define __yas__types__concepts__list_hpp
 
+#include <yas/detail/type_traits/serialized_size.hpp>
+
 namespace yas {
 namespace detail {
 namespace concepts {
@@ -60,8 +62,12 @@ Archive& save(Archive &ar, const C &c) {
         ar.write("]", 1);
     } else {
         ar.write_seq_size(c.size());
-        for ( const auto &it: c ) {
-            ar & it;
+        __YAS_CONSTEXPR_IF ( can_be_counted_in_bulk<F, Archive, typename C::value_type>::value ) {
+            count_in_bulk<F, typename C::value_type>(ar, c.size());
+        } else {
+            for ( const auto &it: c ) {
+                ar & it;
+            }
         }
     }
 
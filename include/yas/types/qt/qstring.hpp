@@ -39,6 +39,7 @@
 #include <yas/detail/type_traits/type_traits.hpp>
 #include <yas/detail/type_traits/serializer.hpp>
 #include <yas/detail/io/serialization_exceptions.hpp>
+#include <yas/detail/tools/wide_units.hpp>
 
 #include <yas/types/qt/qbytearray.hpp>
 
@@ -58,16 +59,39 @@ struct serializer<
 > {
     template<typename Archive>
     static Archive& save(Archive& ar, const QString &str) {
-        return ar & str.toUtf8();
+        return save(ar, str, std::integral_constant<bool, (F & yas::binary) && (F & yas::raw_wide)>{});
     }
 
     template<typename Archive>
     static Archive& load(Archive& ar, QString &str) {
+        return load(ar, str, std::integral_constant<bool, (F & yas::binary) && (F & yas::raw_wide)>{});
+    }
+
+private:
+    template<typename Archive>
+    static Archive& save(Archive& ar, const QString &str, std::false_type) {
+        return ar & str.toUtf8();
+    }
+    template<typename Archive>
+    static Archive& save(Archive& ar, const QString &str, std::true_type) {
+        save_wide_units<F>(ar, str.utf16(), __YAS_SCAST(std::size_t, str.size()));
+
+        return ar;
+    }
+
+    template<typename Archive>
+    static Archive& load(Archive& ar, QString &str, std::false_type) {
         QByteArray arr;
         ar & arr;
 
         str = QString::fromUtf8(arr);
 
+        return ar;
+    }
+    template<typename Archive>
+    static Archive& load(Archive& ar, QString &str, std::true_type) {
+        load_wide_units<F>(ar, str);
+
         return ar;
     }
 };
@@ -38,6 +38,7 @@
 
 #include <yas/detail/type_traits/type_traits.hpp>
 #include <yas/detail/type_traits/serializer.hpp>
+#include <yas/detail/type_traits/serialized_size.hpp>
 #include <yas/detail/io/serialization_exceptions.hpp>
 
 #include <yas/types/concepts/const_sized_array.hpp>
@@ -69,6 +70,13 @@ struct serializer<
 
 /***************************************************************************/
 
+template<std::size_t F, typename T, std::size_t N>
+struct serialized_size_traits<F, std::array<T, N>>
+    :serialized_size_const_array<F, T, N>
+{};
+
+/***************************************************************************/
+
 } // namespace detail
 } // namespace yas
 
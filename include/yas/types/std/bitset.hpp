@@ -39,6 +39,7 @@
 #include <yas/detail/type_traits/type_traits.hpp>
 #include <yas/detail/type_traits/serializer.hpp>
 #include <yas/detail/io/serialization_exceptions.hpp>
+#include <yas/detail/tools/packed_bits.hpp>
 
 #include <bitset>
 #include <vector>
@@ -59,9 +60,7 @@ struct serializer<
     static Archive& save(Archive& ar, const std::bitset<N>& bits) {
         __YAS_CONSTEXPR_IF ( F & yas::json ) {
             std::vector<std::uint8_t> result((N + 7) >> 3);
-            for ( std::size_t idx = 0; idx < N; ++idx ) {
-                result[idx >> 3] = __YAS_SCAST(std::uint8_t, result[idx >> 3] | (bits[idx] << (idx & 7)));
-            }
+            pack_bits(result.data(), bits, 0, N);
 
             ar.write("[", 1);
             ar & result;
@@ -69,9 +68,7 @@ struct serializer<
         } else {
             ar.write_seq_size(N);
             std::vector<std::uint8_t> result((N + 7) >> 3);
-            for ( std::size_t idx = 0; idx < N; ++idx ) {
-                result[idx >> 3] = __YAS_SCAST(std::uint8_t, result[idx >> 3] | (bits[idx] << (idx & 7)));
-            }
+            pack_bits(result.data(), bits, 0, N);
 
             ar & result;
         }
@@ -91,9 +88,7 @@ struct serializer<
                 __YAS_THROW_WRONG_BITSET_STORAGE_SIZE();
             }
 
-            for ( std::size_t idx = 0; idx < N; ++idx ) {
-                bits[idx] = ((buf[idx >> 3] >> (idx & 7)) & 1);
-            }
+            unpack_bits(bits, 0, buf.data(), N);
 
             __YAS_THROW_IF_WRONG_JSON_CHARS(ar, "]");
         }  else {
@@ -107,9 +102,7 @@ struct serializer<
                 __YAS_THROW_WRONG_BITSET_STORAGE_SIZE();
             }
 
-            for ( std::size_t idx = 0; idx < N; ++idx ) {
-                bits[idx] = ((buf[idx >> 3] >> (idx & 7)) & 1);
-            }
+            unpack_bits(bits, 0, buf.data(), N);
         }
 
         return ar;
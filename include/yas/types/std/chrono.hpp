@@ -38,6 +38,7 @@
 
 #include <yas/detail/type_traits/type_traits.hpp>
 #include <yas/detail/type_traits/serializer.hpp>
+#include <yas/detail/type_traits/serialized_size.hpp>
 #include <yas/detail/tools/cast.hpp>
 
 #include <chrono>
@@ -98,6 +99,18 @@ struct serializer<
 
 /***************************************************************************/
 
+template<std::size_t F, typename R, typename P>
+struct serialized_size_traits<F, std::chrono::duration<R, P>, typename std::enable_if<(F & yas::binary)>::type>
+    :serialized_size_traits<F, std::int64_t>
+{};
+
+template<std::size_t F, typename C, typename D>
+struct serialized_size_traits<F, std::chrono::time_point<C, D>, typename std::enable_if<(F & yas::binary)>::type>
+    :serialized_size_traits<F, D>
+{};
+
+/***************************************************************************/
+
 } // namespace detail
 } // namespace yas
 
@@ -38,6 +38,7 @@
 
 #include <yas/detail/type_traits/type_traits.hpp>
 #include <yas/detail/type_traits/serializer.hpp>
+#include <yas/detail/type_traits/serialized_size.hpp>
 #include <yas/detail/io/serialization_exceptions.hpp>
 
 #include <complex>
@@ -91,6 +92,13 @@ struct serializer<
 
 /***************************************************************************/
 
+template<std::size_t F, typename T>
+struct serialized_size_traits<F, std::complex<T>, typename std::enable_if<(F & yas::binary)>::type>
+    :serialized_size_sum<F, T, T>
+{};
+
+/***************************************************************************/
+
 } // namespace detail
 } // namespace yas
 
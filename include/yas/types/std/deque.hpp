@@ -54,14 +54,65 @@ struct serializer<
 	F,
 	std::deque<V>
 > {
+	using by_spans = std::integral_constant<bool,
+		(F & yas::binary) && can_be_processed_as_byte_array<F, V>::value
+	>;
+
 	template<typename Archive>
 	static Archive& save(Archive &ar, const std::deque<V> &deque) {
-		return concepts::list::save<F>(ar, deque);
+		return save(ar, deque, by_spans{});
 	}
 
 	template<typename Archive>
 	static Archive& load(Archive &ar, std::deque<V> &deque) {
-        return concepts::list::load<F>(ar, deque);
+		return load(ar, deque, by_spans{});
+	}
+
+private:
+	template<typename Archive>
+	static Archive& save(Archive &ar, const std::deque<V> &deque, std::false_type) {
+		return concepts::list::save<F>(ar, deque);
+	}
+
+	template<typename Archive>
+	static Archive& load(Archive &ar, std::deque<V> &deque, std::false_type) {
+		return concepts::list::load<F>(ar, deque);
+	}
+
+	// the elements are written by the contiguous spans of the deque blocks,
+	// the bytes are the same as when they are written one by one
+	template<typename Archive>
+	static Archive& save(Archive &ar, const std::deque<V> &deque, std::true_type) {
+		ar.write_seq_size(deque.size());
+		for_each_span(deque.begin(), deque.end(), [&ar](const V *beg, std::size_t n) {
+			ar.write(beg, sizeof(V) * n);
+		});
+
+		return ar;
+	}
+
+	template<typename Archive>
+	static Archive& load(Archive &ar, std::deque<V> &deque, std::true_type) {
+		const auto size = ar.read_seq_size();
+		const auto prev = deque.size();
+		deque.resize(prev + size);
+		for_each_span(deque.begin() + prev, deque.end(), [&ar](V *beg, std::size_t n) {
+			ar.read(beg, sizeof(V) * n);
+		});
+
+		return ar;
+	}
+
+	template<typename It, typename Fn>
+	static void for_each_span(It it, It end, Fn fn) {
+		while ( it != end ) {
+			auto *beg = &*it;
+			std::size_t n = 1;
+			for ( ++it; it != end && &*it == beg + n; ++it ) {
+				++n;
+			}
+			fn(beg, n);
+		}
 	}
 };
 
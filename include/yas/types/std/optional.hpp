@@ -38,6 +38,7 @@
 
 #if __cplusplus >= 201703L
 
+#include <yas/detail/type_traits/serialized_size.hpp>
 #include <yas/types/concepts/optional.hpp>
 
 #include <optional>
@@ -67,6 +68,17 @@ struct serializer<
 
 /***************************************************************************/
 
+template<std::size_t F, typename T>
+struct serialized_size_traits<F, std::optional<T>, typename std::enable_if<(F & yas::binary)>::type>
+    :serialized_size_props<
+         serialized_size_traits<F, T>::bounded
+        ,false
+        ,1 + serialized_size_traits<F, T>::value
+    >
+{};
+
+/***************************************************************************/
+
 } // namespace detail
 } // namespace yas
 
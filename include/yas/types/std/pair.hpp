@@ -38,6 +38,7 @@
 
 #include <yas/detail/type_traits/type_traits.hpp>
 #include <yas/detail/type_traits/serializer.hpp>
+#include <yas/detail/type_traits/serialized_size.hpp>
 
 #include <utility>
 
@@ -87,6 +88,13 @@ struct serializer<
 
 /***************************************************************************/
 
+template<std::size_t F, typename T1, typename T2>
+struct serialized_size_traits<F, std::pair<T1, T2>, typename std::enable_if<(F & yas::binary)>::type>
+    :serialized_size_sum<F, T1, T2>
+{};
+
+/***************************************************************************/
+
 } // namespace detail
 } // namespace yas
 
@@ -40,6 +40,7 @@
 #include <yas/detail/tools/cast.hpp>
 #include <yas/detail/tools/save_load_string.hpp>
 #include <yas/detail/tools/json_tools.hpp>
+#include <yas/detail/tools/strings_dict.hpp>
 
 #include <string>
 #include <cassert>
@@ -67,8 +68,7 @@ struct serializer<
                 ar.write("\"", 1);
             }
         } else {
-            ar.write_seq_size(str.length());
-            ar.write(str.data(), str.length());
+            save_string_bytes<F>(ar, str.data(), str.length());
         }
 
         return ar;
@@ -94,9 +94,7 @@ struct serializer<
                 __YAS_THROW_IF_WRONG_JSON_CHARS(ar, "unreachable");
             }
         } else {
-            const auto size = ar.read_seq_size();
-            str.resize(size);
-            ar.read(__YAS_CCAST(char*, str.data()), size);
+            load_string_bytes<F>(ar, str);
         }
 
         return ar;
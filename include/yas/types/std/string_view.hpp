@@ -40,6 +40,7 @@
 
 #include <yas/detail/type_traits/serializer.hpp>
 #include <yas/detail/tools/save_load_string.hpp>
+#include <yas/detail/tools/strings_dict.hpp>
 
 #include <string_view>
 #include <cassert>
@@ -67,8 +68,7 @@ struct serializer<
                 ar.write("\"", 1);
             }
         } else {
-            ar.write_seq_size(str.length());
-            ar.write(str.data(), str.length());
+            save_string_bytes<F>(ar, str.data(), str.length());
         }
 
         return ar;
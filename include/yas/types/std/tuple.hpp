@@ -38,6 +38,7 @@
 
 #include <yas/detail/type_traits/type_traits.hpp>
 #include <yas/detail/type_traits/serializer.hpp>
+#include <yas/detail/type_traits/serialized_size.hpp>
 #include <yas/detail/io/serialization_exceptions.hpp>
 #include <yas/detail/tools/cast.hpp>
 #include <yas/detail/tools/tuple_element_name.hpp>
@@ -145,6 +146,13 @@ private:
 
 /***************************************************************************/
 
+template<std::size_t F, typename... Types>
+struct serialized_size_traits<F, std::tuple<Types...>, typename std::enable_if<(F & yas::binary)>::type>
+    :serialized_size_sum<F, std::uint8_t, Types...>
+{};
+
+/***************************************************************************/
+
 } // namespace detail
 } // namespace yas
 
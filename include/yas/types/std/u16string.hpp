@@ -38,6 +38,7 @@
 #define __yas__types__std__std_u16string_serializers_hpp
 
 #include <yas/detail/tools/utf8conv.hpp>
+#include <yas/detail/tools/wide_units.hpp>
 
 #include <yas/detail/type_traits/type_traits.hpp>
 #include <yas/detail/type_traits/serializer.hpp>
@@ -56,19 +57,40 @@ struct serializer<
 > {
 	template<typename Archive>
 	static Archive& save(Archive& ar, const std::u16string& u16string) {
+		return save(ar, u16string, std::integral_constant<bool, (F & yas::binary) && (F & yas::raw_wide)>{});
+	}
+
+	template<typename Archive>
+	static Archive& load(Archive& ar, std::u16string& u16string) {
+		return load(ar, u16string, std::integral_constant<bool, (F & yas::binary) && (F & yas::raw_wide)>{});
+	}
+
+private:
+	template<typename Archive>
+	static Archive& save(Archive& ar, const std::u16string& u16string, std::false_type) {
 		std::string dst;
 		detail::TypeConverter<std::string, std::u16string>::Convert(dst, u16string);
 		ar & dst;
 		return ar;
 	}
+	template<typename Archive>
+	static Archive& save(Archive& ar, const std::u16string& u16string, std::true_type) {
+		save_wide_units<F>(ar, u16string.data(), u16string.size());
+		return ar;
+	}
 
 	template<typename Archive>
-	static Archive& load(Archive& ar, std::u16string& u16string) {
+	static Archive& load(Archive& ar, std::u16string& u16string, std::false_type) {
 		std::string string;
 		ar & string;
 		detail::TypeConverter<std::u16string, std::string>::Convert(u16string, string);
 		return ar;
 	}
+	template<typename Archive>
+	static Archive& load(Archive& ar, std::u16string& u16string, std::true_type) {
+		load_wide_units<F>(ar, u16string);
+		return ar;
+	}
 };
 
 /***************************************************************************/
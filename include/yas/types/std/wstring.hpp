@@ -38,6 +38,7 @@
 #define __yas__types__std__std_wstring_serializers_hpp
 
 #include <yas/detail/tools/utf8conv.hpp>
+#include <yas/detail/tools/wide_units.hpp>
 
 #include <yas/detail/type_traits/type_traits.hpp>
 #include <yas/detail/type_traits/serializer.hpp>
@@ -56,19 +57,40 @@ struct serializer<
 > {
 	template<typename Archive>
 	static Archive& save(Archive& ar, const std::wstring& wstring) {
+		return save(ar, wstring, std::integral_constant<bool, (F & yas::binary) && (F & yas::raw_wide)>{});
+	}
+
+	template<typename Archive>
+	static Archive& load(Archive& ar, std::wstring& wstring) {
+		return load(ar, wstring, std::integral_constant<bool, (F & yas::binary) && (F & yas::raw_wide)>{});
+	}
+
+private:
+	template<typename Archive>
+	static Archive& save(Archive& ar, const std::wstring& wstring, std::false_type) {
 		std::string dst;
 		detail::TypeConverter<std::string, std::wstring>::Convert(dst, wstring);
 		ar & dst;
 		return ar;
 	}
+	template<typename Archive>
+	static Archive& save(Archive& ar, const std::wstring& wstring, std::true_type) {
+		save_wide_units<F>(ar, wstring.data(), wstring.size());
+		return ar;
+	}
 
 	template<typename Archive>
-	static Archive& load(Archive& ar, std::wstring& wstring) {
+	static Archive& load(Archive& ar, std::wstring& wstring, std::false_type) {
 		std::string string;
 		ar & string;
 		detail::TypeConverter<std::wstring, std::string>::Convert(wstring, string);
 		return ar;
 	}
+	template<typename Archive>
+	static Archive& load(Archive& ar, std::wstring& wstring, std::true_type) {
+		load_wide_units<F>(ar, wstring);
+		return ar;
+	}
 };
 
 /***************************************************************************/
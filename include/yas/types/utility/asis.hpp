@@ -38,6 +38,7 @@
 
 #include <yas/detail/type_traits/type_traits.hpp>
 #include <yas/detail/type_traits/serializer.hpp>
+#include <yas/detail/type_traits/serialized_size.hpp>
 
 #include <yas/tools/wrap_asis.hpp>
 
@@ -78,6 +79,16 @@ struct serializer<
 
 /***************************************************************************/
 
+template<std::size_t F, typename T>
+struct serialized_size_traits<F, asis_wrapper<T>, typename std::enable_if<(F & yas::binary)>::type>
+    :serialized_size_traits<
+         (F & ~yas::compacted)
+        ,typename std::remove_cv<typename std::remove_reference<T>::type>::type
+    >
+{};
+
+/***************************************************************************/
+
 } // namespace detail
 } // namespace yas
 
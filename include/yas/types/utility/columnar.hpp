@@ -0,0 +1,312 @@
+
+// Copyright (c) 2010-2021 niXman (github dot nixman at pm dot me). All
+// rights reserved.
+//
+// This file is part of YAS(https://github.com/niXman/yas) project.
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//
+//
+// Boost Software License - Version 1.0 - August 17th, 2003
+//
+// Permission is hereby granted, free of charge, to any person or organization
+// obtaining a copy of the software and accompanying documentation covered by
+// this license (the "Software") to use, reproduce, display, distribute,
+// execute, and transmit the Software, and to prepare derivative works of the
+// Software, and to permit third-parties to whom the Software is furnished to
+// do so, all subject to the following:
+//
+// The copyright notices in the Software and this entire statement, including
+// the above license grant, this restriction and the following disclaimer,
+// must be included in all copies of the Software, in whole or in part, and
+// all derivative works of the Software, unless such copies or derivative
+// works are solely in the form of machine-executable object code generated by
+// a source language processor.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+// SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+// FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+
+
+#ifndef __yas__types__utility__columnar_hpp
+#define __yas__types__utility__columnar_hpp
+
+#include <yas/detail/type_traits/type_traits.hpp>
+#include <yas/detail/type_traits/serializer.hpp>
+#include <yas/detail/io/io_exceptions.hpp>
+#include <yas/types/concepts/array.hpp>
+
+#include <yas/object.hpp>
+#include <yas/tools/wrap_columnar.hpp>
+
+#include <vector>
+
+namespace yas {
+namespace detail {
+
+/***************************************************************************/
+
+// the stand-in archive which is passed to serialize() of the elements.
+// it takes the object built by serialize() and hands it to the visitor.
+template<std::size_t F, typename V>
+struct columnar_probe {
+    static constexpr std::size_t flags() { return F; }
+
+    template<typename KVI, typename... Pairs>
+    columnar_probe& operator& (const object<KVI, Pairs...> &o) {
+        visitor(o);
+        return *this;
+    }
+
+    V &visitor;
+};
+
+template<std::size_t F, typename T, typename V>
+void columnar_visit_save(const T &v, V &visitor) {
+    using probe_type = columnar_probe<F, V>;
+    probe_type probe{visitor};
+    serializer<
+         type_properties<T>::value
+        ,serialization_method<T, probe_type>::value
+        ,F
+        ,T
+    >::save(probe, v);
+}
+
+template<std::size_t F, typename T, typename V>
+void columnar_visit_load(T &v, V &visitor) {
+    using probe_type = columnar_probe<F, V>;
+    probe_type probe{visitor};
+    serializer<
+         type_properties<T>::value
+        ,serialization_method<T, probe_type>::value
+        ,F
+        ,T
+    >::load(probe, v);
+}
+
+template<std::size_t I, typename O>
+using columnar_field_type = typename std::decay<
+    decltype(std::get<I>(std::declval<const O &>().pairs).val)
+>::type;
+
+// the fields of these types are gathered by the chunks, so the column goes
+// through the bulk array paths. the chunk size is a multiple of the block
+// sizes of those paths, so the column is encoded as the whole std::vector
+// would be. the integer columns of compacted archives are always encoded by
+// the blocks, with or without 'yas::int_blocks'.
+enum: std::size_t { columnar_chunk_size = 4096 };
+
+template<typename X>
+using columnar_is_gathered = std::integral_constant<bool,
+    std::is_arithmetic<X>::value || std::is_enum<X>::value
+>;
+
+template<std::size_t I, typename X>
+struct columnar_gather {
+    template<typename O>
+    void operator()(const O &o) { col[idx] = std::get<I>(o.pairs).val; }
+
+    std::vector<X> &col;
+    std::size_t idx;
+};
+
+template<std::size_t I, typename X>
+struct columnar_scatter {
+    template<typename O>
+    void operator()(const O &o) { std::get<I>(o.pairs).val = col[idx]; }
+
+    const std::vector<X> &col;
+    std::size_t idx;
+};
+
+template<std::size_t I, typename Archive>
+struct columnar_field_io {
+    template<typename O>
+    void operator()(const O &o) { ar & std::get<I>(o.pairs).val; }
+
+    Archive &ar;
+};
+
+/***************************************************************************/
+
+template<std::size_t F, typename Archive, typename C>
+struct columnar_saver {
+    template<typename KVI, typename... Pairs>
+    void operator()(const object<KVI, Pairs...> &) {
+        apply<0, object<KVI, Pairs...>>();
+    }
+
+    Archive &ar;
+    const C &c;
+
+private:
+    template<std::size_t I, typename O>
+    typename std::enable_if<I == std::tuple_size<typename O::tuple>::value>::type
+    apply() {}
+
+    template<std::size_t I, typename O>
+    typename std::enable_if<I < std::tuple_size<typename O::tuple>::value>::type
+    apply() {
+        using field_type = columnar_field_type<I, O>;
+        save_column<I, field_type>(columnar_is_gathered<field_type>{});
+
+        apply<I+1, O>();
+    }
+
+    template<std::size_t I, typename X>
+    void save_column(std::true_type) {
+        using chunk_type = std::vector<X>;
+        using contiguous = std::is_same<X&, typename chunk_type::reference>;
+        using cond = concepts::array::processing_tag<F|yas::int_blocks, X, contiguous::value>;
+
+        ar.write_seq_size(c.size());
+        chunk_type chunk;
+        columnar_gather<I, X> gather{chunk, 0};
+        auto it = c.begin();
+        for ( std::size_t left = c.size(); left; left -= chunk.size() ) {
+            chunk.resize(left < columnar_chunk_size ? left : columnar_chunk_size);
+            for ( gather.idx = 0; gather.idx < chunk.size(); ++gather.idx, ++it ) {
+                columnar_visit_save<F>(*it, gather);
+            }
+            concepts::array::save_array<F>(ar, chunk, cond{});
+        }
+    }
+
+    template<std::size_t I, typename X>
+    void save_column(std::false_type) {
+        ar.write_seq_size(c.size());
+        columnar_field_io<I, Archive> io{ar};
+        for ( const auto &it: c ) {
+            columnar_visit_save<F>(it, io);
+        }
+    }
+};
+
+template<std::size_t F, typename Archive, typename C>
+struct columnar_loader {
+    template<typename KVI, typename... Pairs>
+    void operator()(const object<KVI, Pairs...> &) {
+        apply<0, object<KVI, Pairs...>>();
+    }
+
+    Archive &ar;
+    C &c;
+
+private:
+    template<std::size_t I, typename O>
+    typename std::enable_if<I == std::tuple_size<typename O::tuple>::value>::type
+    apply() {}
+
+    template<std::size_t I, typename O>
+    typename std::enable_if<I < std::tuple_size<typename O::tuple>::value>::type
+    apply() {
+        using field_type = columnar_field_type<I, O>;
+        load_column<I, field_type>(columnar_is_gathered<field_type>{});
+
+        apply<I+1, O>();
+    }
+
+    template<std::size_t I, typename X>
+    void load_column(std::true_type) {
+        using chunk_type = std::vector<X>;
+        using contiguous = std::is_same<X&, typename chunk_type::reference>;
+        using cond = concepts::array::processing_tag<F|yas::int_blocks, X, contiguous::value>;
+
+        if ( ar.read_seq_size() != c.size() ) {
+            __YAS_THROW_BAD_COLUMN_SIZE();
+        }
+        chunk_type chunk;
+        columnar_scatter<I, X> scatter{chunk, 0};
+        auto it = c.begin();
+        for ( std::size_t left = c.size(); left; left -= chunk.size() ) {
+            chunk.resize(left < columnar_chunk_size ? left : columnar_chunk_size);
+            concepts::array::load_array(ar, chunk, cond{});
+            for ( scatter.idx = 0; scatter.idx < chunk.size(); ++scatter.idx, ++it ) {
+                columnar_visit_load<F>(*it, scatter);
+            }
+        }
+    }
+
+    template<std::size_t I, typename X>
+    void load_column(std::false_type) {
+        if ( ar.read_seq_size() != c.size() ) {
+            __YAS_THROW_BAD_COLUMN_SIZE();
+        }
+        columnar_field_io<I, Archive> io{ar};
+        for ( auto &it: c ) {
+            columnar_visit_load<F>(it, io);
+        }
+    }
+};
+
+/***************************************************************************/
+
+template<std::size_t F, typename T>
+struct serializer<
+    type_prop::not_a_fundamental,
+    ser_case::use_internal_serializer,
+    F,
+    columnar_wrapper<T>
+> {
+    using binary_tag = std::integral_constant<bool, (F & yas::binary) != 0>;
+
+    template<typename Archive>
+    static Archive& save(Archive &ar, const columnar_wrapper<T> &v) {
+        return save(ar, v.val, binary_tag{});
+    }
+
+    template<typename Archive>
+    static Archive& load(Archive &ar, columnar_wrapper<T> &v) {
+        return load(ar, v.val, binary_tag{});
+    }
+
+private:
+    template<typename Archive, typename C>
+    static Archive& save(Archive &ar, const C &c, std::false_type) {
+        return ar & c;
+    }
+
+    // the size of the vector is followed by the columns, the types of the
+    // fields are taken from the object built by the first element
+    template<typename Archive, typename C>
+    static Archive& save(Archive &ar, const C &c, std::true_type) {
+        ar.write_seq_size(c.size());
+        if ( !c.empty() ) {
+            columnar_saver<F, Archive, C> saver{ar, c};
+            columnar_visit_save<F>(c.front(), saver);
+        }
+
+        return ar;
+    }
+
+    template<typename Archive, typename C>
+    static Archive& load(Archive &ar, C &c, std::false_type) {
+        return ar & c;
+    }
+
+    template<typename Archive, typename C>
+    static Archive& load(Archive &ar, C &c, std::true_type) {
+        const auto size = ar.read_seq_size();
+        c.resize(size);
+        if ( size ) {
+            columnar_loader<F, Archive, C> loader{ar, c};
+            columnar_visit_load<F>(c.front(), loader);
+        }
+
+        return ar;
+    }
+};
+
+/***************************************************************************/
+
+} // namespace detail
+} // namespace yas
+
+#endif // __yas__types__utility__columnar_hpp
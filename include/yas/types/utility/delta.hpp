@@ -0,0 +1,196 @@
+
+// Copyright (c) 2010-2021 niXman (github dot nixman at pm dot me). All
+// rights reserved.
+//
+// This file is part of YAS(https://github.com/niXman/yas) project.
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//
+//
+// Boost Software License - Version 1.0 - August 17th, 2003
+//
+// Permission is hereby granted, free of charge, to any person or organization
+// obtaining a copy of the software and accompanying documentation covered by
+// this license (the "Software") to use, reproduce, display, distribute,
+// execute, and transmit the Software, and to prepare derivative works of the
+// Software, and to permit third-parties to whom the Software is furnished to
+// do so, all subject to the following:
+//
+// The copyright notices in the Software and this entire statement, including
+// the above license grant, this restriction and the following disclaimer,
+// must be included in all copies of the Software, in whole or in part, and
+// all derivative works of the Software, unless such copies or derivative
+// works are solely in the form of machine-executable object code generated by
+// a source language processor.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+// SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+// FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+
+
+#ifndef __yas__types__utility__delta_hpp
+#define __yas__types__utility__delta_hpp
+
+#include <yas/detail/type_traits/type_traits.hpp>
+#include <yas/detail/type_traits/serializer.hpp>
+#include <yas/detail/io/int_block_codec.hpp>
+
+#include <yas/tools/wrap_delta.hpp>
+
+#include <functional>
+
+namespace yas {
+namespace detail {
+
+/***************************************************************************/
+
+template<std::size_t F, typename C, typename = void>
+struct can_be_delta_encoded: std::false_type {};
+
+template<std::size_t F, typename C>
+struct can_be_delta_encoded<F, C, void_t<typename C::key_compare>>: std::integral_constant<bool,
+    (F & yas::binary) &&
+    std::is_same<typename C::key_compare, std::less<typename C::key_type>>::value &&
+    (is_signed_integer<typename C::key_type>::value || is_unsigned_integer<typename C::key_type>::value) &&
+    (sizeof(typename C::key_type) == 2 || sizeof(typename C::key_type) == 4 || sizeof(typename C::key_type) == 8)
+>
+{};
+
+/***************************************************************************/
+
+template<std::size_t F, typename T>
+struct serializer<
+    type_prop::not_a_fundamental,
+    ser_case::use_internal_serializer,
+    F,
+    delta_wrapper<T>
+> {
+    using container_type = typename std::decay<T>::type;
+
+    template<typename Archive>
+    static Archive& save(Archive &ar, const delta_wrapper<T> &v) {
+        return save(ar, v.val, can_be_delta_encoded<F, container_type>{});
+    }
+
+    template<typename Archive>
+    static Archive& load(Archive &ar, delta_wrapper<T> &v) {
+        return load(ar, v.val, can_be_delta_encoded<F, container_type>{});
+    }
+
+private:
+    template<typename Archive, typename C>
+    static Archive& save(Archive &ar, const C &c, std::false_type) {
+        return ar & c;
+    }
+
+    // the deltas are stored by the blocks, for maps every block of the keys
+    // is followed by the block of the mapped values
+    template<typename Archive, typename C>
+    static Archive& save(Archive &ar, const C &c, std::true_type) {
+        using U = typename std::make_unsigned<typename C::key_type>::type;
+
+        ar.write_seq_size(c.size());
+
+        U deltas[int_block_codec::block_size];
+        U prev = 0;
+        for ( auto it = c.begin(); it != c.end(); ) {
+            const auto beg = it;
+            std::size_t n = 0;
+            for ( ; it != c.end() && n < int_block_codec::block_size; ++it, ++n ) {
+                const U key = to_ordered(key_of(*it, has_mapped_type<C>{}));
+                deltas[n] = __YAS_SCAST(U, key - prev);
+                prev = key;
+            }
+            ar.write_int_block(deltas, n);
+            save_mapped(ar, beg, it, has_mapped_type<C>{});
+        }
+
+        return ar;
+    }
+
+    template<typename Archive, typename C>
+    static Archive& load(Archive &ar, C &c, std::false_type) {
+        return ar & c;
+    }
+
+    template<typename Archive, typename C>
+    static Archive& load(Archive &ar, C &c, std::true_type) {
+        using K = typename C::key_type;
+        using U = typename std::make_unsigned<K>::type;
+
+        auto size = ar.read_seq_size();
+
+        U deltas[int_block_codec::block_size];
+        U prev = 0;
+        while ( size ) {
+            const std::size_t n = (size < int_block_codec::block_size)
+                ? size
+                : __YAS_SCAST(std::size_t, int_block_codec::block_size)
+            ;
+            ar.read_int_block(deltas, n);
+            for ( std::size_t i = 0; i < n; ++i ) {
+                prev = __YAS_SCAST(U, prev + deltas[i]);
+                // the keys are loaded in order, so the end is the right hint
+                emplace_back(ar, c, from_ordered<K>(prev), has_mapped_type<C>{});
+            }
+            size -= n;
+        }
+
+        return ar;
+    }
+
+    // the signed keys are mapped to the unsigned ones preserving the order
+    template<typename K>
+    static typename std::make_unsigned<K>::type to_ordered(const K &k) {
+        using U = typename std::make_unsigned<K>::type;
+        return std::is_signed<K>::value
+            ? __YAS_SCAST(U, __YAS_SCAST(U, k) ^ __YAS_SCAST(U, U{1} << (sizeof(U) * 8 - 1)))
+            : __YAS_SCAST(U, k)
+        ;
+    }
+    template<typename K, typename U>
+    static K from_ordered(const U &u) {
+        return std::is_signed<K>::value
+            ? __YAS_SCAST(K, __YAS_SCAST(U, u ^ __YAS_SCAST(U, U{1} << (sizeof(U) * 8 - 1))))
+            : __YAS_SCAST(K, u)
+        ;
+    }
+
+    template<typename V>
+    static const typename V::first_type& key_of(const V &v, std::true_type) { return v.first; }
+    template<typename V>
+    static const V& key_of(const V &v, std::false_type) { return v; }
+
+    template<typename Archive, typename It>
+    static void save_mapped(Archive &ar, It beg, It end, std::true_type) {
+        for ( ; beg != end; ++beg ) {
+            ar & beg->second;
+        }
+    }
+    template<typename Archive, typename It>
+    static void save_mapped(Archive &, It, It, std::false_type) {}
+
+    template<typename Archive, typename C>
+    static void emplace_back(Archive &ar, C &c, const typename C::key_type &k, std::true_type) {
+        typename C::mapped_type v = typename C::mapped_type();
+        ar & v;
+        c.emplace_hint(c.end(), k, std::move(v));
+    }
+    template<typename Archive, typename C>
+    static void emplace_back(Archive &, C &c, const typename C::key_type &k, std::false_type) {
+        c.emplace_hint(c.end(), k);
+    }
+};
+
+/***************************************************************************/
+
+} // namespace detail
+} // namespace yas
+
+#endif // __yas__types__utility__delta_hpp
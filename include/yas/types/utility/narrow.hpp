@@ -0,0 +1,98 @@
+
+// Copyright (c) 2010-2021 niXman (github dot nixman at pm dot me). All
+// rights reserved.
+//
+// This file is part of YAS(https://github.com/niXman/yas) project.
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//
+//
+// Boost Software License - Version 1.0 - August 17th, 2003
+//
+// Permission is hereby granted, free of charge, to any person or organization
+// obtaining a copy of the software and accompanying documentation covered by
+// this license (the "Software") to use, reproduce, display, distribute,
+// execute, and transmit the Software, and to prepare derivative works of the
+// Software, and to permit third-parties to whom the Software is furnished to
+// do so, all subject to the following:
+//
+// The copyright notices in the Software and this entire statement, including
+// the above license grant, this restriction and the following disclaimer,
+// must be included in all copies of the Software, in whole or in part, and
+// all derivative works of the Software, unless such copies or derivative
+// works are solely in the form of machine-executable object code generated by
+// a source language processor.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+// SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+// FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+
+
+#ifndef __yas__types__utility__narrow_hpp
+#define __yas__types__utility__narrow_hpp
+
+#include <yas/detail/type_traits/type_traits.hpp>
+#include <yas/detail/type_traits/serializer.hpp>
+
+#include <yas/tools/wrap_narrow.hpp>
+
+namespace yas {
+namespace detail {
+
+/***************************************************************************/
+
+template<std::size_t F, typename T>
+struct serializer<
+    type_prop::not_a_fundamental,
+    ser_case::use_internal_serializer,
+    F,
+    narrow_wrapper<T>
+> {
+    using is_narrowed = std::integral_constant<bool, (F & yas::binary) && (F & yas::compacted)>;
+
+    template<typename Archive>
+    static Archive& save(Archive &ar, const narrow_wrapper<T> &v) {
+        return save(ar, v.val, is_narrowed{});
+    }
+
+    template<typename Archive>
+    static Archive& load(Archive &ar, narrow_wrapper<T> &v) {
+        return load(ar, v.val, is_narrowed{});
+    }
+
+private:
+    template<typename Archive, typename V>
+    static Archive& save(Archive &ar, const V &v, std::false_type) {
+        return ar & v;
+    }
+    template<typename Archive, typename V>
+    static Archive& save(Archive &ar, const V &v, std::true_type) {
+        ar.write_narrowed(v);
+
+        return ar;
+    }
+
+    template<typename Archive, typename V>
+    static Archive& load(Archive &ar, V &v, std::false_type) {
+        return ar & v;
+    }
+    template<typename Archive, typename V>
+    static Archive& load(Archive &ar, V &v, std::true_type) {
+        ar.read_narrowed(v);
+
+        return ar;
+    }
+};
+
+/***************************************************************************/
+
+} // namespace detail
+} // namespace yas
+
+#endif // __yas__types__utility__narrow_hpp
@@ -38,17 +38,33 @@
 
 #include <yas/detail/type_traits/type_traits.hpp>
 #include <yas/detail/type_traits/serializer.hpp>
+#include <yas/detail/type_traits/serialized_size.hpp>
 #include <yas/detail/tools/cast.hpp>
 #include <yas/detail/tools/tuple_element_switch.hpp>
 #include <yas/detail/tools/json_tools.hpp>
 
 #include <yas/object.hpp>
 
+#include <cstring>
+
 namespace yas {
 namespace detail {
 
 /***************************************************************************/
 
+// the type of the value stored by the pair
+template<typename T>
+struct pair_value_type {
+    using type = T;
+};
+
+template<typename T>
+struct pair_value_type<value<T>> {
+    using type = typename std::remove_cv<typename std::remove_reference<T>::type>::type;
+};
+
+/***************************************************************************/
+
 template<std::size_t F, typename KVI, typename... Pairs>
 struct serializer<
     type_prop::not_a_fundamental,
@@ -101,6 +117,12 @@ private:
     template<std::size_t I = 0, typename Archive, typename... Tp>
     static typename std::enable_if<I < sizeof...(Tp), Archive &>::type
     apply(Archive &ar, const std::tuple<Tp...> &t) {
+        using run = fused_run_from<F, I, typename pair_value_type<Tp>::type...>;
+        return apply_run<I>(ar, t, std::integral_constant<bool, (run::length > 1)>{});
+    }
+
+    template<std::size_t I, typename Archive, typename... Tp>
+    static Archive& apply_run(Archive &ar, const std::tuple<Tp...> &t, std::false_type) {
         ar & std::get<I>(t);
 
         __YAS_CONSTEXPR_IF ( (F & yas::json) && I+1 < sizeof...(Tp) ) {
@@ -110,6 +132,28 @@ private:
         return apply<I+1>(ar, t);
     }
 
+    // the run of the fixed-size fundamentals is stored into the buffer and
+    // written by one call
+    template<std::size_t I, typename Archive, typename... Tp>
+    static Archive& apply_run(Archive &ar, const std::tuple<Tp...> &t, std::true_type) {
+        using run = fused_run_from<F, I, typename pair_value_type<Tp>::type...>;
+        std::uint8_t buf[run::size];
+        put_run<I, I + run::length, Archive>(buf, t);
+        ar.write(buf, sizeof(buf));
+
+        return apply<I + run::length>(ar, t);
+    }
+
+    template<std::size_t I, std::size_t E, typename Archive, typename... Tp>
+    static typename std::enable_if<I == E>::type
+    put_run(std::uint8_t *, const std::tuple<Tp...> &) {}
+
+    template<std::size_t I, std::size_t E, typename Archive, typename... Tp>
+    static typename std::enable_if<I != E>::type
+    put_run(std::uint8_t *p, const std::tuple<Tp...> &t) {
+        put_run<I+1, E, Archive>(Archive::put_fixed(p, std::get<I>(t).val), t);
+    }
+
     // load
     template<std::size_t I = 0, typename Archive, typename M, typename... Tp>
     static typename std::enable_if<I == sizeof...(Tp), Archive &>::type
@@ -134,16 +178,45 @@ private:
     template<std::size_t I = 0, typename Archive, typename M, typename... Tp>
     static typename std::enable_if<I < sizeof...(Tp), Archive &>::type
     apply(Archive &ar, const M &m, std::tuple<Tp...> &t) {
+        using run = fused_run_from<F, I, typename pair_value_type<Tp>::type...>;
+        return apply_run<I>(ar, m, t, std::integral_constant<bool, (run::length > 1)>{});
+    }
+
+    // the run of the fixed-size fundamentals is read by one call and loaded
+    // from the buffer
+    template<std::size_t I, typename Archive, typename M, typename... Tp>
+    static Archive& apply_run(Archive &ar, const M &m, std::tuple<Tp...> &t, std::true_type) {
+        using run = fused_run_from<F, I, typename pair_value_type<Tp>::type...>;
+        std::uint8_t buf[run::size];
+        ar.read(buf, sizeof(buf));
+        get_run<I, I + run::length, Archive>(buf, t);
+
+        return apply<I + run::length>(ar, m, t);
+    }
+
+    template<std::size_t I, std::size_t E, typename Archive, typename... Tp>
+    static typename std::enable_if<I == E>::type
+    get_run(const std::uint8_t *, std::tuple<Tp...> &) {}
+
+    template<std::size_t I, std::size_t E, typename Archive, typename... Tp>
+    static typename std::enable_if<I != E>::type
+    get_run(const std::uint8_t *p, std::tuple<Tp...> &t) {
+        get_run<I+1, E, Archive>(Archive::get_fixed(p, std::get<I>(t).val), t);
+    }
+
+    template<std::size_t I, typename Archive, typename M, typename... Tp>
+    static Archive& apply_run(Archive &ar, const M &m, std::tuple<Tp...> &t, std::false_type) {
         __YAS_CONSTEXPR_IF ( F & yas::json ) {
             __YAS_CONSTEXPR_IF ( F & yas::compacted ) {
                 ar & std::get<I>(t);
             } else {
                 while ( true ) {
-                    char key[1024];
+                    char buf[1024];
+                    const char *key = buf;
                     // pre-key double quote
                     json_skipws(ar);
                     __YAS_THROW_IF_WRONG_JSON_CHARS(ar, "\"");
-                    json_read_key(ar, key, sizeof(key));
+                    const std::size_t klen = json_read_key(ar, buf, sizeof(buf), key);
 
                     // post-key double quote
                     __YAS_THROW_IF_WRONG_JSON_CHARS(ar, "\"");
@@ -153,7 +226,15 @@ private:
                     __YAS_THROW_IF_WRONG_JSON_CHARS(ar, ":");
                     json_skipws(ar);
 
-                    const std::uint32_t hash = fnv1a(key);
+                    // the keys are written in the declared order, so this one is
+                    // most likely the expected one
+                    const auto &expected = std::get<I>(t);
+                    if ( klen == expected.klen && std::memcmp(key, expected.key, klen) == 0 ) {
+                        ar & std::get<I>(t);
+                        break;
+                    }
+
+                    const std::uint32_t hash = fnv1a_range(key, key + klen);
                     const auto it = m.find(hash);
                     if ( it.key ) {
                         tuple_switch(ar, it.val, t);
@@ -193,6 +274,13 @@ private:
 
 /***************************************************************************/
 
+template<std::size_t F, typename KVI, typename... Pairs>
+struct serialized_size_traits<F, object<KVI, Pairs...>>
+    :serialized_size_sum<F, typename std::decay<Pairs>::type...>
+{};
+
+/***************************************************************************/
+
 } // namespace detail
 } // namespace yas
 
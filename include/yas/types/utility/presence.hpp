@@ -0,0 +1,306 @@
+
+// Copyright (c) 2010-2021 niXman (github dot nixman at pm dot me). All
+// rights reserved.
+//
+// This file is part of YAS(https://github.com/niXman/yas) project.
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//
+//
+// Boost Software License - Version 1.0 - August 17th, 2003
+//
+// Permission is hereby granted, free of charge, to any person or organization
+// obtaining a copy of the software and accompanying documentation covered by
+// this license (the "Software") to use, reproduce, display, distribute,
+// execute, and transmit the Software, and to prepare derivative works of the
+// Software, and to permit third-parties to whom the Software is furnished to
+// do so, all subject to the following:
+//
+// The copyright notices in the Software and this entire statement, including
+// the above license grant, this restriction and the following disclaimer,
+// must be included in all copies of the Software, in whole or in part, and
+// all derivative works of the Software, unless such copies or derivative
+// works are solely in the form of machine-executable object code generated by
+// a source language processor.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+// SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+// FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+
+
+#ifndef __yas__types__utility__presence_hpp
+#define __yas__types__utility__presence_hpp
+
+#include <yas/detail/type_traits/type_traits.hpp>
+#include <yas/detail/type_traits/serializer.hpp>
+#include <yas/types/utility/object.hpp>
+
+#include <yas/tools/wrap_presence.hpp>
+
+#include <cstring>
+
+namespace yas {
+namespace detail {
+
+/***************************************************************************/
+
+// std::optional, boost::optional and the like
+template<typename T, typename = void>
+struct is_optional_like: std::false_type {};
+
+template<typename T>
+struct is_optional_like<T, void_t<
+     typename T::value_type
+    ,decltype(std::declval<T &>().reset())
+    ,decltype(std::declval<T &>().emplace())
+    ,decltype(*std::declval<T &>())
+>>: std::true_type {};
+
+// the arrays are never compared
+struct not_default_comparable {};
+
+template<typename T>
+using default_comparable_type = typename std::conditional<
+     std::is_array<T>::value
+    ,not_default_comparable
+    ,T
+>::type;
+
+template<typename T, typename = void>
+struct is_default_comparable: std::false_type {};
+
+template<typename T>
+struct is_default_comparable<T, void_t<
+    decltype(std::declval<const default_comparable_type<T> &>() == std::declval<const default_comparable_type<T> &>())
+>>: std::is_default_constructible<T>
+{};
+
+// how the field is marked in the presence bitmap
+struct presence_always { enum { skippable = 0 }; };
+struct presence_optional { enum { skippable = 1 }; };
+struct presence_defaulted { enum { skippable = 1 }; };
+
+template<bool ElideDefaults, typename T>
+using presence_kind = typename std::conditional<
+     is_optional_like<T>::value
+    ,presence_optional
+    ,typename std::conditional<
+         ElideDefaults && is_default_comparable<T>::value
+        ,presence_defaulted
+        ,presence_always
+    >::type
+>::type;
+
+template<bool ElideDefaults, typename... Pairs>
+struct presence_bits {
+    static constexpr std::size_t value = 0;
+};
+
+template<bool ElideDefaults, typename P, typename... Pairs>
+struct presence_bits<ElideDefaults, P, Pairs...> {
+    static constexpr std::size_t value =
+        presence_kind<ElideDefaults, typename pair_value_type<P>::type>::skippable
+        + presence_bits<ElideDefaults, Pairs...>::value
+    ;
+};
+
+/***************************************************************************/
+
+template<std::size_t F, bool ElideDefaults, typename O>
+struct presence_codec;
+
+// the bitmap has a bit for every skippable field only, it is followed by
+// the present fields. the optionals are written without their own flag.
+template<std::size_t F, bool ElideDefaults, typename KVI, typename... Pairs>
+struct presence_codec<F, ElideDefaults, object<KVI, Pairs...>> {
+    using tuple_type = std::tuple<Pairs...>;
+
+    enum: std::size_t {
+         bits_count = presence_bits<ElideDefaults, Pairs...>::value
+        ,bitmap_size = (bits_count + 7) / 8
+    };
+
+    template<typename Archive>
+    static Archive& save(Archive &ar, const object<KVI, Pairs...> &o) {
+        std::uint8_t bits[bitmap_size + 1] = {};
+        mark<0, 0>(bits, o.pairs);
+        if ( bitmap_size ) {
+            ar.write(bits, __YAS_SCAST(std::size_t, bitmap_size));
+        }
+        put<0, 0>(ar, bits, o.pairs);
+
+        return ar;
+    }
+
+    template<typename Archive>
+    static Archive& load(Archive &ar, object<KVI, Pairs...> &o) {
+        std::uint8_t bits[bitmap_size + 1] = {};
+        if ( bitmap_size ) {
+            ar.read(bits, __YAS_SCAST(std::size_t, bitmap_size));
+        }
+        get<0, 0>(ar, bits, o.pairs);
+
+        return ar;
+    }
+
+private:
+    template<std::size_t I>
+    using kind_of = presence_kind<
+         ElideDefaults
+        ,typename pair_value_type<typename std::tuple_element<I, tuple_type>::type>::type
+    >;
+
+    static bool is_set(const std::uint8_t *bits, std::size_t b) {
+        return (bits[b / 8] >> (b % 8)) & 1u;
+    }
+
+    // marking
+    template<std::size_t I, std::size_t B>
+    static typename std::enable_if<I == sizeof...(Pairs)>::type
+    mark(std::uint8_t *, const tuple_type &) {}
+
+    template<std::size_t I, std::size_t B>
+    static typename std::enable_if<I < sizeof...(Pairs)>::type
+    mark(std::uint8_t *bits, const tuple_type &t) {
+        if ( is_present(std::get<I>(t).val, kind_of<I>{}) ) {
+            bits[B / 8] |= __YAS_SCAST(std::uint8_t, 1u << (B % 8));
+        }
+        mark<I+1, B + kind_of<I>::skippable>(bits, t);
+    }
+
+    template<typename T>
+    static bool is_present(const T &, presence_always) { return false; }
+    template<typename T>
+    static bool is_present(const T &v, presence_optional) { return __YAS_SCAST(bool, v); }
+    template<typename T>
+    static bool is_present(const T &v, presence_defaulted) { return !is_default(v, std::is_floating_point<T>{}); }
+
+    template<typename T>
+    static bool is_default(const T &v, std::false_type) { return v == T{}; }
+    // by the bits, so -0.0 is present and is not loaded back as +0.0
+    template<typename T>
+    static bool is_default(const T &v, std::true_type) {
+        const T def{};
+        return std::memcmp(&v, &def, sizeof(T)) == 0;
+    }
+
+    // saving
+    template<std::size_t I, std::size_t B, typename Archive>
+    static typename std::enable_if<I == sizeof...(Pairs)>::type
+    put(Archive &, const std::uint8_t *, const tuple_type &) {}
+
+    template<std::size_t I, std::size_t B, typename Archive>
+    static typename std::enable_if<I < sizeof...(Pairs)>::type
+    put(Archive &ar, const std::uint8_t *bits, const tuple_type &t) {
+        put_field(ar, bits, B, std::get<I>(t).val, kind_of<I>{});
+        put<I+1, B + kind_of<I>::skippable>(ar, bits, t);
+    }
+
+    template<typename Archive, typename T>
+    static void put_field(Archive &ar, const std::uint8_t *, std::size_t, const T &v, presence_always) {
+        ar & v;
+    }
+    template<typename Archive, typename T>
+    static void put_field(Archive &ar, const std::uint8_t *bits, std::size_t b, const T &v, presence_optional) {
+        if ( is_set(bits, b) ) {
+            ar & *v;
+        }
+    }
+    template<typename Archive, typename T>
+    static void put_field(Archive &ar, const std::uint8_t *bits, std::size_t b, const T &v, presence_defaulted) {
+        if ( is_set(bits, b) ) {
+            ar & v;
+        }
+    }
+
+    // loading
+    template<std::size_t I, std::size_t B, typename Archive>
+    static typename std::enable_if<I == sizeof...(Pairs)>::type
+    get(Archive &, const std::uint8_t *, tuple_type &) {}
+
+    template<std::size_t I, std::size_t B, typename Archive>
+    static typename std::enable_if<I < sizeof...(Pairs)>::type
+    get(Archive &ar, const std::uint8_t *bits, tuple_type &t) {
+        get_field(ar, bits, B, std::get<I>(t).val, kind_of<I>{});
+        get<I+1, B + kind_of<I>::skippable>(ar, bits, t);
+    }
+
+    template<typename Archive, typename T>
+    static void get_field(Archive &ar, const std::uint8_t *, std::size_t, T &v, presence_always) {
+        ar & v;
+    }
+    template<typename Archive, typename T>
+    static void get_field(Archive &ar, const std::uint8_t *bits, std::size_t b, T &v, presence_optional) {
+        if ( is_set(bits, b) ) {
+            v.emplace();
+            ar & *v;
+        } else {
+            v.reset();
+        }
+    }
+    template<typename Archive, typename T>
+    static void get_field(Archive &ar, const std::uint8_t *bits, std::size_t b, T &v, presence_defaulted) {
+        if ( is_set(bits, b) ) {
+            ar & v;
+        } else {
+            v = T{};
+        }
+    }
+};
+
+/***************************************************************************/
+
+template<std::size_t F, typename T, bool ElideDefaults>
+struct serializer<
+    type_prop::not_a_fundamental,
+    ser_case::use_internal_serializer,
+    F,
+    presence_wrapper<T, ElideDefaults>
+> {
+    using object_type = typename std::decay<T>::type;
+    using binary_tag = std::integral_constant<bool, (F & yas::binary) != 0>;
+
+    template<typename Archive>
+    static Archive& save(Archive &ar, const presence_wrapper<T, ElideDefaults> &v) {
+        return save(ar, v.val, binary_tag{});
+    }
+
+    template<typename Archive>
+    static Archive& load(Archive &ar, presence_wrapper<T, ElideDefaults> &v) {
+        return load(ar, v.val, binary_tag{});
+    }
+
+private:
+    template<typename Archive>
+    static Archive& save(Archive &ar, const object_type &o, std::false_type) {
+        return ar & o;
+    }
+
+    template<typename Archive>
+    static Archive& load(Archive &ar, object_type &o, std::false_type) {
+        return ar & o;
+    }
+
+    template<typename Archive>
+    static Archive& save(Archive &ar, const object_type &o, std::true_type) {
+        return presence_codec<F, ElideDefaults, object_type>::save(ar, o);
+    }
+
+    template<typename Archive>
+    static Archive& load(Archive &ar, object_type &o, std::true_type) {
+        return presence_codec<F, ElideDefaults, object_type>::load(ar, o);
+    }
+};
+
+/***************************************************************************/
+
+} // namespace detail
+} // namespace yas
+
+#endif // __yas__types__utility__presence_hpp
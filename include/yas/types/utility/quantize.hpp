@@ -0,0 +1,218 @@
+
+// Copyright (c) 2010-2021 niXman (github dot nixman at pm dot me). All
+// rights reserved.
+//
+// This file is part of YAS(https://github.com/niXman/yas) project.
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//
+//
+// Boost Software License - Version 1.0 - August 17th, 2003
+//
+// Permission is hereby granted, free of charge, to any person or organization
+// obtaining a copy of the software and accompanying documentation covered by
+// this license (the "Software") to use, reproduce, display, distribute,
+// execute, and transmit the Software, and to prepare derivative works of the
+// Software, and to permit third-parties to whom the Software is furnished to
+// do so, all subject to the following:
+//
+// The copyright notices in the Software and this entire statement, including
+// the above license grant, this restriction and the following disclaimer,
+// must be included in all copies of the Software, in whole or in part, and
+// all derivative works of the Software, unless such copies or derivative
+// works are solely in the form of machine-executable object code generated by
+// a source language processor.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+// SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+// FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+
+
+#ifndef __yas__types__utility__quantize_hpp
+#define __yas__types__utility__quantize_hpp
+
+#include <yas/detail/type_traits/type_traits.hpp>
+#include <yas/detail/type_traits/serializer.hpp>
+#include <yas/detail/io/serialization_exceptions.hpp>
+#include <yas/detail/tools/quantize.hpp>
+#include <yas/types/concepts/array.hpp>
+
+#include <yas/tools/wrap_quantize.hpp>
+
+#include <limits>
+#include <vector>
+
+namespace yas {
+namespace detail {
+
+/***************************************************************************/
+
+// the values are converted by the chunks and every chunk is stored as
+// the array of the storage type S
+enum: std::size_t { quantize_chunk_size = 4096 };
+
+template<typename Q>
+struct quantize_codec;
+
+template<>
+struct quantize_codec<f16> {
+    static void encode(std::uint16_t *dst, const float *src, std::size_t size) { quantizer::to_f16(dst, src, size); }
+    static void decode(float *dst, const std::uint16_t *src, std::size_t size) { quantizer::from_f16(dst, src, size); }
+};
+
+template<>
+struct quantize_codec<bf16> {
+    static void encode(std::uint16_t *dst, const float *src, std::size_t size) { quantizer::to_bf16(dst, src, size); }
+    static void decode(float *dst, const std::uint16_t *src, std::size_t size) { quantizer::from_bf16(dst, src, size); }
+};
+
+struct fixed_point_codec {
+    template<typename T>
+    void encode(std::int32_t *dst, const T *src, std::size_t size) const { quantizer::to_fixed(dst, src, size, scale); }
+    template<typename T>
+    void decode(T *dst, const std::int32_t *src, std::size_t size) const { quantizer::from_fixed(dst, src, size, scale); }
+
+    double scale;
+};
+
+template<std::size_t F, typename S, typename Archive, typename C, typename Codec>
+void save_quantized(Archive &ar, const C &c, const Codec &codec) {
+    using cond = concepts::array::processing_tag<F, S>;
+
+    ar.write_seq_size(c.size());
+    std::vector<S> chunk;
+    for ( std::size_t pos = 0; pos < c.size(); pos += chunk.size() ) {
+        const std::size_t left = c.size() - pos;
+        chunk.resize(left < quantize_chunk_size ? left : quantize_chunk_size);
+        codec.encode(&chunk[0], c.data() + pos, chunk.size());
+        concepts::array::save_array<F>(ar, chunk, cond{});
+    }
+}
+
+template<std::size_t F, typename S, typename Archive, typename C, typename Codec>
+void load_quantized(Archive &ar, C &c, const Codec &codec) {
+    using cond = concepts::array::processing_tag<F, S>;
+
+    c.resize(ar.read_seq_size());
+    std::vector<S> chunk;
+    for ( std::size_t pos = 0; pos < c.size(); pos += chunk.size() ) {
+        const std::size_t left = c.size() - pos;
+        chunk.resize(left < quantize_chunk_size ? left : quantize_chunk_size);
+        concepts::array::load_array(ar, chunk, cond{});
+        codec.decode(c.data() + pos, &chunk[0], chunk.size());
+    }
+}
+
+/***************************************************************************/
+
+template<std::size_t F, typename Q, typename T>
+struct serializer<
+    type_prop::not_a_fundamental,
+    ser_case::use_internal_serializer,
+    F,
+    quantize_wrapper<Q, T>
+> {
+    // the half-floats are not compressible by the integer codecs
+    enum: std::size_t { flags = F & ~yas::compacted };
+
+    template<typename Archive>
+    static Archive& save(Archive &ar, const quantize_wrapper<Q, T> &v) {
+        return save(ar, v.val, std::integral_constant<bool, (F & yas::binary) != 0>{});
+    }
+
+    template<typename Archive>
+    static Archive& load(Archive &ar, quantize_wrapper<Q, T> &v) {
+        return load(ar, v.val, std::integral_constant<bool, (F & yas::binary) != 0>{});
+    }
+
+private:
+    template<typename Archive, typename C>
+    static Archive& save(Archive &ar, const C &c, std::false_type) {
+        return ar & c;
+    }
+    template<typename Archive, typename C>
+    static Archive& save(Archive &ar, const C &c, std::true_type) {
+        save_quantized<flags, std::uint16_t>(ar, c, quantize_codec<Q>{});
+
+        return ar;
+    }
+
+    template<typename Archive, typename C>
+    static Archive& load(Archive &ar, C &c, std::false_type) {
+        return ar & c;
+    }
+    template<typename Archive, typename C>
+    static Archive& load(Archive &ar, C &c, std::true_type) {
+        load_quantized<flags, std::uint16_t>(ar, c, quantize_codec<Q>{});
+
+        return ar;
+    }
+};
+
+/***************************************************************************/
+
+template<std::size_t F, typename T>
+struct serializer<
+    type_prop::not_a_fundamental,
+    ser_case::use_internal_serializer,
+    F,
+    fixed_point_wrapper<T>
+> {
+    template<typename Archive>
+    static Archive& save(Archive &ar, const fixed_point_wrapper<T> &v) {
+        check_scale(v.scale);
+
+        return save(ar, v.val, v.scale, std::integral_constant<bool, (F & yas::binary) != 0>{});
+    }
+
+    template<typename Archive>
+    static Archive& load(Archive &ar, fixed_point_wrapper<T> &v) {
+        check_scale(v.scale);
+
+        return load(ar, v.val, v.scale, std::integral_constant<bool, (F & yas::binary) != 0>{});
+    }
+
+private:
+    // rejects zero, the negatives, the infinities and NaN
+    static void check_scale(double scale) {
+        if ( !(scale > 0 && scale <= (std::numeric_limits<double>::max)()) ) {
+            __YAS_THROW_BAD_FIXED_POINT_SCALE();
+        }
+    }
+
+    template<typename Archive, typename C>
+    static Archive& save(Archive &ar, const C &c, double, std::false_type) {
+        return ar & c;
+    }
+    // in compacted mode the integers are always stored by int_block_codec
+    template<typename Archive, typename C>
+    static Archive& save(Archive &ar, const C &c, double scale, std::true_type) {
+        save_quantized<F|yas::int_blocks, std::int32_t>(ar, c, fixed_point_codec{scale});
+
+        return ar;
+    }
+
+    template<typename Archive, typename C>
+    static Archive& load(Archive &ar, C &c, double, std::false_type) {
+        return ar & c;
+    }
+    template<typename Archive, typename C>
+    static Archive& load(Archive &ar, C &c, double scale, std::true_type) {
+        load_quantized<F|yas::int_blocks, std::int32_t>(ar, c, fixed_point_codec{scale});
+
+        return ar;
+    }
+};
+
+/***************************************************************************/
+
+} // namespace detail
+} // namespace yas
+
+#endif // __yas__types__utility__quantize_hpp
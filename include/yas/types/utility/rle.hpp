@@ -0,0 +1,194 @@
+
+// Copyright (c) 2010-2021 niXman (github dot nixman at pm dot me). All
+// rights reserved.
+//
+// This file is part of YAS(https://github.com/niXman/yas) project.
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//
+//
+// Boost Software License - Version 1.0 - August 17th, 2003
+//
+// Permission is hereby granted, free of charge, to any person or organization
+// obtaining a copy of the software and accompanying documentation covered by
+// this license (the "Software") to use, reproduce, display, distribute,
+// execute, and transmit the Software, and to prepare derivative works of the
+// Software, and to permit third-parties to whom the Software is furnished to
+// do so, all subject to the following:
+//
+// The copyright notices in the Software and this entire statement, including
+// the above license grant, this restriction and the following disclaimer,
+// must be included in all copies of the Software, in whole or in part, and
+// all derivative works of the Software, unless such copies or derivative
+// works are solely in the form of machine-executable object code generated by
+// a source language processor.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+// SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+// FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+
+
+#ifndef __yas__types__utility__rle_hpp
+#define __yas__types__utility__rle_hpp
+
+#include <yas/detail/type_traits/type_traits.hpp>
+#include <yas/detail/type_traits/serializer.hpp>
+#include <yas/detail/io/io_exceptions.hpp>
+
+#include <yas/tools/wrap_rle.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace yas {
+namespace detail {
+
+/***************************************************************************/
+
+// the container is stored as the sequence of the blocks, every block starts
+// with the LEB128 header '(length << 1) | is_run':
+//   run:     the value, repeated 'length' times
+//   literal: 'length' values
+// the runs shorter than 'rle_min_run' are merged into the literals.
+enum: std::size_t { rle_min_run = 4 };
+
+template<std::size_t F, typename T>
+struct serializer<
+    type_prop::not_a_fundamental,
+    ser_case::use_internal_serializer,
+    F,
+    rle_wrapper<T>
+> {
+    using container_type = typename std::decay<T>::type;
+    using value_type = typename container_type::value_type;
+    using is_bytes = can_be_processed_as_byte_array<F, value_type>;
+
+    template<typename Archive>
+    static Archive& save(Archive &ar, const rle_wrapper<T> &v) {
+        return save(ar, v.val, std::integral_constant<bool, (F & yas::binary) != 0>{});
+    }
+
+    template<typename Archive>
+    static Archive& load(Archive &ar, rle_wrapper<T> &v) {
+        return load(ar, v.val, std::integral_constant<bool, (F & yas::binary) != 0>{});
+    }
+
+private:
+    template<typename Archive>
+    static Archive& save(Archive &ar, const container_type &c, std::false_type) {
+        return ar & c;
+    }
+    template<typename Archive>
+    static Archive& save(Archive &ar, const container_type &c, std::true_type) {
+        const value_type *p = c.data();
+        const std::size_t size = c.size();
+
+        ar.write_seq_size(size);
+        std::size_t lit = 0;
+        for ( std::size_t i = 0; i < size; ) {
+            std::size_t j = i + 1;
+            for ( ; j < size && same(p[j], p[i]); ++j )
+                ;
+            if ( j - i >= rle_min_run ) {
+                save_literal(ar, p + lit, i - lit);
+                ar.write_varint(((j - i) << 1) | 1u);
+                ar & p[i];
+                lit = j;
+            }
+            i = j;
+        }
+        save_literal(ar, p + lit, size - lit);
+
+        return ar;
+    }
+
+    template<typename Archive>
+    static Archive& load(Archive &ar, container_type &c, std::false_type) {
+        return ar & c;
+    }
+    template<typename Archive>
+    static Archive& load(Archive &ar, container_type &c, std::true_type) {
+        const std::size_t size = ar.read_seq_size();
+        c.resize(size);
+        value_type *p = c.data();
+
+        for ( std::size_t pos = 0; pos < size; ) {
+            const std::size_t header = ar.read_varint();
+            const std::size_t len = header >> 1;
+            if ( len == 0 || len > size - pos ) {
+                __YAS_THROW_BAD_RUN_LENGTH();
+            }
+            if ( header & 1u ) {
+                value_type v{};
+                ar & v;
+                fill(p + pos, len, v);
+            } else {
+                load_literal(ar, p + pos, len, is_bytes{});
+            }
+            pos += len;
+        }
+
+        return ar;
+    }
+
+    template<typename Archive>
+    static void save_literal(Archive &ar, const value_type *p, std::size_t len) {
+        if ( len ) {
+            ar.write_varint(len << 1);
+            save_literal(ar, p, len, is_bytes{});
+        }
+    }
+    template<typename Archive>
+    static void save_literal(Archive &ar, const value_type *p, std::size_t len, std::true_type) {
+        ar.write(p, len * sizeof(value_type));
+    }
+    template<typename Archive>
+    static void save_literal(Archive &ar, const value_type *p, std::size_t len, std::false_type) {
+        for ( const value_type *e = p + len; p != e; ++p ) {
+            ar & *p;
+        }
+    }
+
+    template<typename Archive>
+    static void load_literal(Archive &ar, value_type *p, std::size_t len, std::true_type) {
+        ar.read(p, len * sizeof(value_type));
+    }
+    template<typename Archive>
+    static void load_literal(Archive &ar, value_type *p, std::size_t len, std::false_type) {
+        for ( value_type *e = p + len; p != e; ++p ) {
+            ar & *p;
+        }
+    }
+
+    static void fill(value_type *p, std::size_t len, const value_type &v) {
+        if ( same(v, value_type{}) ) {
+            std::memset(p, 0, len * sizeof(value_type));
+        } else {
+            std::fill(p, p + len, v);
+        }
+    }
+
+    // the signed zeros are distinguished, the NaNs are never equal
+    template<typename U>
+    static bool same(const U &a, const U &b, __YAS_ENABLE_IF_IS_ANY_OF(U, float, double, long double)) {
+        return a == b && std::signbit(a) == std::signbit(b);
+    }
+    template<typename U>
+    static bool same(const U &a, const U &b, __YAS_DISABLE_IF_IS_ANY_OF(U, float, double, long double)) {
+        return a == b;
+    }
+};
+
+/***************************************************************************/
+
+} // namespace detail
+} // namespace yas
+
+#endif // __yas__types__utility__rle_hpp
@@ -0,0 +1,148 @@
+
+// Copyright (c) 2010-2021 niXman (github dot nixman at pm dot me). All
+// rights reserved.
+//
+// This file is part of YAS(https://github.com/niXman/yas) project.
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//
+//
+// Boost Software License - Version 1.0 - August 17th, 2003
+//
+// Permission is hereby granted, free of charge, to any person or organization
+// obtaining a copy of the software and accompanying documentation covered by
+// this license (the "Software") to use, reproduce, display, distribute,
+// execute, and transmit the Software, and to prepare derivative works of the
+// Software, and to permit third-parties to whom the Software is furnished to
+// do so, all subject to the following:
+//
+// The copyright notices in the Software and this entire statement, including
+// the above license grant, this restriction and the following disclaimer,
+// must be included in all copies of the Software, in whole or in part, and
+// all derivative works of the Software, unless such copies or derivative
+// works are solely in the form of machine-executable object code generated by
+// a source language processor.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+// SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+// FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+
+
+#ifndef __yas__types__utility__sparse_hpp
+#define __yas__types__utility__sparse_hpp
+
+#include <yas/detail/type_traits/type_traits.hpp>
+#include <yas/detail/type_traits/serializer.hpp>
+#include <yas/detail/io/io_exceptions.hpp>
+
+#include <yas/tools/wrap_sparse.hpp>
+
+#include <cmath>
+#include <cstring>
+
+namespace yas {
+namespace detail {
+
+/***************************************************************************/
+
+// the container is stored as its size, the number of the non-zero values,
+// and for every non-zero value the LEB128 count of the zeros before it
+// followed by the value itself.
+template<std::size_t F, typename T>
+struct serializer<
+    type_prop::not_a_fundamental,
+    ser_case::use_internal_serializer,
+    F,
+    sparse_wrapper<T>
+> {
+    using container_type = typename std::decay<T>::type;
+    using value_type = typename container_type::value_type;
+
+    template<typename Archive>
+    static Archive& save(Archive &ar, const sparse_wrapper<T> &v) {
+        return save(ar, v.val, std::integral_constant<bool, (F & yas::binary) != 0>{});
+    }
+
+    template<typename Archive>
+    static Archive& load(Archive &ar, sparse_wrapper<T> &v) {
+        return load(ar, v.val, std::integral_constant<bool, (F & yas::binary) != 0>{});
+    }
+
+private:
+    template<typename Archive>
+    static Archive& save(Archive &ar, const container_type &c, std::false_type) {
+        return ar & c;
+    }
+    template<typename Archive>
+    static Archive& save(Archive &ar, const container_type &c, std::true_type) {
+        const value_type *p = c.data();
+        const std::size_t size = c.size();
+
+        std::size_t nonzeros = 0;
+        for ( std::size_t i = 0; i < size; ++i ) {
+            nonzeros += !is_zero(p[i]);
+        }
+
+        ar.write_seq_size(size);
+        ar.write_varint(nonzeros);
+        for ( std::size_t i = 0, next = 0; nonzeros; ++i ) {
+            if ( !is_zero(p[i]) ) {
+                ar.write_varint(i - next);
+                ar & p[i];
+                next = i + 1;
+                --nonzeros;
+            }
+        }
+
+        return ar;
+    }
+
+    template<typename Archive>
+    static Archive& load(Archive &ar, container_type &c, std::false_type) {
+        return ar & c;
+    }
+    template<typename Archive>
+    static Archive& load(Archive &ar, container_type &c, std::true_type) {
+        const std::size_t size = ar.read_seq_size();
+        c.resize(size);
+        value_type *p = c.data();
+        if ( size ) {
+            std::memset(p, 0, size * sizeof(value_type));
+        }
+
+        std::size_t nonzeros = ar.read_varint();
+        for ( std::size_t pos = 0; nonzeros; --nonzeros, ++pos ) {
+            const std::size_t skip = ar.read_varint();
+            if ( pos >= size || skip >= size - pos ) {
+                __YAS_THROW_BAD_RUN_LENGTH();
+            }
+            pos += skip;
+            ar & p[pos];
+        }
+
+        return ar;
+    }
+
+    // the negative zeros are stored
+    template<typename U>
+    static bool is_zero(const U &v, __YAS_ENABLE_IF_IS_ANY_OF(U, float, double, long double)) {
+        return v == 0 && !std::signbit(v);
+    }
+    template<typename U>
+    static bool is_zero(const U &v, __YAS_DISABLE_IF_IS_ANY_OF(U, float, double, long double)) {
+        return v == 0;
+    }
+};
+
+/***************************************************************************/
+
+} // namespace detail
+} // namespace yas
+
+#endif // __yas__types__utility__sparse_hpp
@@ -0,0 +1,199 @@
+
+// Copyright (c) 2010-2021 niXman (github dot nixman at pm dot me). All
+// rights reserved.
+//
+// This file is part of YAS(https://github.com/niXman/yas) project.
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//
+//
+// Boost Software License - Version 1.0 - August 17th, 2003
+//
+// Permission is hereby granted, free of charge, to any person or organization
+// obtaining a copy of the software and accompanying documentation covered by
+// this license (the "Software") to use, reproduce, display, distribute,
+// execute, and transmit the Software, and to prepare derivative works of the
+// Software, and to permit third-parties to whom the Software is furnished to
+// do so, all subject to the following:
+//
+// The copyright notices in the Software and this entire statement, including
+// the above license grant, this restriction and the following disclaimer,
+// must be included in all copies of the Software, in whole or in part, and
+// all derivative works of the Software, unless such copies or derivative
+// works are solely in the form of machine-executable object code generated by
+// a source language processor.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+// SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+// FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+
+
+#ifndef __yas__types__utility__string_table_hpp
+#define __yas__types__utility__string_table_hpp
+
+#include <yas/detail/type_traits/type_traits.hpp>
+#include <yas/detail/type_traits/serializer.hpp>
+#include <yas/detail/io/int_block_codec.hpp>
+
+#include <yas/tools/wrap_string_table.hpp>
+
+#include <limits>
+#include <vector>
+
+namespace yas {
+namespace detail {
+
+/***************************************************************************/
+
+// the container is stored as its size, then by the blocks of up to
+// 'string_table_block' strings: the lengths by int_block_codec, the bytes
+// of all the strings, and for the maps the mapped values.
+// the loader reads every block by two calls and assigns the strings from
+// the slices, reusing the strings of the loaded vector.
+enum: std::size_t { string_table_block = 1024 };
+
+template<std::size_t F, typename T>
+struct serializer<
+    type_prop::not_a_fundamental,
+    ser_case::use_internal_serializer,
+    F,
+    string_table_wrapper<T>
+> {
+    using container_type = typename std::decay<T>::type;
+    using is_map = has_mapped_type<container_type>;
+
+    template<typename Archive>
+    static Archive& save(Archive &ar, const string_table_wrapper<T> &v) {
+        return save(ar, v.val, std::integral_constant<bool, (F & yas::binary) != 0>{});
+    }
+
+    template<typename Archive>
+    static Archive& load(Archive &ar, string_table_wrapper<T> &v) {
+        return load(ar, v.val, std::integral_constant<bool, (F & yas::binary) != 0>{}, is_map{});
+    }
+
+private:
+    template<typename Archive>
+    static Archive& save(Archive &ar, const container_type &c, std::false_type) {
+        return ar & c;
+    }
+    template<typename Archive>
+    static Archive& save(Archive &ar, const container_type &c, std::true_type) {
+        std::uint64_t lens[string_table_block];
+
+        ar.write_seq_size(c.size());
+        for ( auto it = c.begin(); it != c.end(); ) {
+            const auto beg = it;
+            std::size_t n = 0;
+            for ( ; it != c.end() && n < string_table_block; ++it, ++n ) {
+                lens[n] = key_of(*it, is_map{}).size();
+            }
+            ar.write_int_block(lens, n);
+            for ( auto j = beg; j != it; ++j ) {
+                const auto &s = key_of(*j, is_map{});
+                if ( !s.empty() ) {
+                    ar.write(s.data(), s.size());
+                }
+            }
+            save_mapped(ar, beg, it, is_map{});
+        }
+
+        return ar;
+    }
+
+    template<typename Archive, typename IsMap>
+    static Archive& load(Archive &ar, container_type &c, std::false_type, IsMap) {
+        return ar & c;
+    }
+    template<typename Archive>
+    static Archive& load(Archive &ar, container_type &c, std::true_type, std::false_type) {
+        std::uint64_t lens[string_table_block];
+        std::vector<char> blob;
+
+        std::size_t size = ar.read_seq_size();
+        c.resize(size);
+        auto it = c.begin();
+        while ( size ) {
+            const std::size_t n = read_block(ar, lens, blob, size);
+            const char *p = blob.data();
+            for ( std::size_t i = 0; i < n; ++i, ++it ) {
+                it->assign(p, __YAS_SCAST(std::size_t, lens[i]));
+                p += lens[i];
+            }
+            size -= n;
+        }
+
+        return ar;
+    }
+    template<typename Archive>
+    static Archive& load(Archive &ar, container_type &c, std::true_type, std::true_type) {
+        using key_type = typename container_type::key_type;
+        using mapped_type = typename container_type::mapped_type;
+
+        std::uint64_t lens[string_table_block];
+        std::vector<char> blob;
+
+        std::size_t size = ar.read_seq_size();
+        while ( size ) {
+            const std::size_t n = read_block(ar, lens, blob, size);
+            const char *p = blob.data();
+            for ( std::size_t i = 0; i < n; ++i ) {
+                key_type k(p, __YAS_SCAST(std::size_t, lens[i]));
+                p += lens[i];
+                mapped_type v = mapped_type();
+                ar & v;
+                c.emplace_hint(c.end(), std::move(k), std::move(v));
+            }
+            size -= n;
+        }
+
+        return ar;
+    }
+
+    // reads the lengths and the bytes of the next block, returns the number of the strings
+    template<typename Archive>
+    static std::size_t read_block(Archive &ar, std::uint64_t *lens, std::vector<char> &blob, std::size_t left) {
+        const std::size_t n = (left < string_table_block) ? left : __YAS_SCAST(std::size_t, string_table_block);
+        ar.read_int_block(lens, n);
+
+        // the lengths of a corrupted archive can overflow the sum
+        std::size_t bytes = 0;
+        for ( std::size_t i = 0; i < n; ++i ) {
+            __YAS_THROW_READ_STORAGE_SIZE_ERROR(lens[i] > (std::numeric_limits<std::size_t>::max)() - bytes);
+            bytes += __YAS_SCAST(std::size_t, lens[i]);
+        }
+        blob.resize(bytes);
+        if ( bytes ) {
+            ar.read(blob.data(), blob.size());
+        }
+
+        return n;
+    }
+
+    template<typename V>
+    static const typename V::first_type& key_of(const V &v, std::true_type) { return v.first; }
+    template<typename V>
+    static const V& key_of(const V &v, std::false_type) { return v; }
+
+    template<typename Archive, typename It>
+    static void save_mapped(Archive &ar, It beg, It end, std::true_type) {
+        for ( ; beg != end; ++beg ) {
+            ar & beg->second;
+        }
+    }
+    template<typename Archive, typename It>
+    static void save_mapped(Archive &, It, It, std::false_type) {}
+};
+
+/***************************************************************************/
+
+} // namespace detail
+} // namespace yas
+
+#endif // __yas__types__utility__string_table_hpp
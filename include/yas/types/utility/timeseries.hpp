@@ -0,0 +1,388 @@
+
+// Copyright (c) 2010-2021 niXman (github dot nixman at pm dot me). All
+// rights reserved.
+//
+// This file is part of YAS(https://github.com/niXman/yas) project.
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//
+//
+// Boost Software License - Version 1.0 - August 17th, 2003
+//
+// Permission is hereby granted, free of charge, to any person or organization
+// obtaining a copy of the software and accompanying documentation covered by
+// this license (the "Software") to use, reproduce, display, distribute,
+// execute, and transmit the Software, and to prepare derivative works of the
+// Software, and to permit third-parties to whom the Software is furnished to
+// do so, all subject to the following:
+//
+// The copyright notices in the Software and this entire statement, including
+// the above license grant, this restriction and the following disclaimer,
+// must be included in all copies of the Software, in whole or in part, and
+// all derivative works of the Software, unless such copies or derivative
+// works are solely in the form of machine-executable object code generated by
+// a source language processor.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+// SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+// FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+
+
+#ifndef __yas__types__utility__timeseries_hpp
+#define __yas__types__utility__timeseries_hpp
+
+#include <yas/detail/type_traits/type_traits.hpp>
+#include <yas/detail/type_traits/serializer.hpp>
+#include <yas/detail/io/endian_conv.hpp>
+#include <yas/detail/io/int_block_codec.hpp>
+#include <yas/detail/io/io_exceptions.hpp>
+
+#include <yas/tools/wrap_timeseries.hpp>
+
+#include <chrono>
+#include <cstring>
+
+namespace yas {
+namespace detail {
+
+/***************************************************************************/
+
+// the tags for the elements of the series
+struct timeseries_ticks {};
+struct timeseries_floats {};
+
+template<typename T, typename = void>
+struct timeseries_element { using type = std::false_type; };
+
+template<typename T>
+struct timeseries_element<T, typename std::enable_if<
+    (is_signed_integer<T>::value || is_unsigned_integer<T>::value) && sizeof(T) >= 2 && sizeof(T) <= 8
+>::type> { using type = timeseries_ticks; };
+
+template<typename R, typename P>
+struct timeseries_element<std::chrono::duration<R, P>, typename std::enable_if<
+    std::is_integral<R>::value
+>::type> { using type = timeseries_ticks; };
+
+template<typename C, typename D>
+struct timeseries_element<std::chrono::time_point<C, D>, typename std::enable_if<
+    std::is_integral<typename D::rep>::value
+>::type> { using type = timeseries_ticks; };
+
+template<typename T>
+struct timeseries_element<T, typename std::enable_if<
+    std::is_same<T, float>::value || std::is_same<T, double>::value
+>::type> { using type = timeseries_floats; };
+
+/***************************************************************************/
+
+template<std::size_t F, typename T>
+struct serializer<
+    type_prop::not_a_fundamental,
+    ser_case::use_internal_serializer,
+    F,
+    timeseries_wrapper<T>
+> {
+    using container_type = typename std::decay<T>::type;
+    using element_type = typename container_type::value_type;
+    using tag = typename std::conditional<
+         (F & yas::binary) != 0
+        ,typename timeseries_element<element_type>::type
+        ,std::false_type
+    >::type;
+
+    template<typename Archive>
+    static Archive& save(Archive &ar, const timeseries_wrapper<T> &v) {
+        return save(ar, v.val, tag{});
+    }
+
+    template<typename Archive>
+    static Archive& load(Archive &ar, timeseries_wrapper<T> &v) {
+        return load(ar, v.val, tag{});
+    }
+
+private:
+    template<typename Archive, typename C>
+    static Archive& save(Archive &ar, const C &c, std::false_type) {
+        return ar & c;
+    }
+
+    template<typename Archive, typename C>
+    static Archive& load(Archive &ar, C &c, std::false_type) {
+        return ar & c;
+    }
+
+    /***************************************************************************/
+    // the delta-of-delta of the timestamps, written by the blocks of the integers codec.
+    // the first delta is written as is.
+
+    template<typename Archive, typename C>
+    static Archive& save(Archive &ar, const C &c, timeseries_ticks) {
+        ar.write_seq_size(c.size());
+
+        std::int64_t dods[int_block_codec::block_size];
+        std::uint64_t prev = 0, prevdelta = 0;
+        std::size_t n = 0;
+        bool first = true;
+        for ( const auto &it: c ) {
+            const std::uint64_t t = __YAS_SCAST(std::uint64_t, to_ticks(it));
+            const std::uint64_t delta = t - prev;
+            dods[n++] = __YAS_SCAST(std::int64_t, delta - prevdelta);
+            prev = t;
+            prevdelta = first ? 0 : delta;
+            first = false;
+            if ( n == int_block_codec::block_size ) {
+                ar.write_int_block(dods, n);
+                n = 0;
+            }
+        }
+        if ( n ) {
+            ar.write_int_block(dods, n);
+        }
+
+        return ar;
+    }
+
+    template<typename Archive, typename C>
+    static Archive& load(Archive &ar, C &c, timeseries_ticks) {
+        auto size = ar.read_seq_size();
+        c.resize(size);
+
+        std::int64_t dods[int_block_codec::block_size];
+        std::uint64_t prev = 0, prevdelta = 0;
+        bool first = true;
+        auto it = c.begin();
+        while ( size ) {
+            const std::size_t n = (size < int_block_codec::block_size)
+                ? size
+                : __YAS_SCAST(std::size_t, int_block_codec::block_size)
+            ;
+            ar.read_int_block(dods, n);
+            for ( std::size_t i = 0; i < n; ++i, ++it ) {
+                const std::uint64_t delta = prevdelta + __YAS_SCAST(std::uint64_t, dods[i]);
+                prev += delta;
+                from_ticks(__YAS_SCAST(std::int64_t, prev), *it);
+                prevdelta = first ? 0 : delta;
+                first = false;
+            }
+            size -= n;
+        }
+
+        return ar;
+    }
+
+    template<typename V>
+    static std::int64_t to_ticks(const V &v) { return __YAS_SCAST(std::int64_t, v); }
+    template<typename R, typename P>
+    static std::int64_t to_ticks(const std::chrono::duration<R, P> &d) { return __YAS_SCAST(std::int64_t, d.count()); }
+    template<typename C, typename D>
+    static std::int64_t to_ticks(const std::chrono::time_point<C, D> &t) { return to_ticks(t.time_since_epoch()); }
+
+    template<typename V>
+    static void from_ticks(std::int64_t v, V &r) { r = __YAS_SCAST(V, v); }
+    template<typename R, typename P>
+    static void from_ticks(std::int64_t v, std::chrono::duration<R, P> &d) { d = std::chrono::duration<R, P>(__YAS_SCAST(R, v)); }
+    template<typename C, typename D>
+    static void from_ticks(std::int64_t v, std::chrono::time_point<C, D> &t) {
+        D d{};
+        from_ticks(v, d);
+        t = std::chrono::time_point<C, D>(d);
+    }
+
+    /***************************************************************************/
+    // the values XOR-ed with the previous ones, every one is stored as:
+    //   '0' for the same value,
+    //   '10' and the meaningful bits, when they fit into the previous window,
+    //   '11', 5 bits of the leading zeros, 5/6 bits of the length, and the meaningful bits.
+    // the bits are written by the chunks of 'chunk_size' values, every chunk is prefixed by its size in bytes.
+
+    enum: std::size_t {
+         chunk_size = 512
+        ,padding = 24
+        ,max_chunk_bytes = (chunk_size * (2 + 5 + 6 + 64) + 7) / 8
+    };
+
+    template<typename U>
+    struct xor_window {
+        std::size_t leading = sizeof(U) * 8; // no window yet
+        std::size_t trailing = 0;
+    };
+
+    struct bit_writer {
+        explicit bit_writer(std::uint8_t *buf)
+            :buf(buf)
+            ,pos(0)
+            ,bits(0)
+            ,acc(0)
+        {}
+
+        std::uint8_t *buf;
+        std::size_t pos;
+        std::size_t bits;
+        std::uint64_t acc;
+
+        void put(std::uint64_t v, std::size_t n) {
+            if ( n > 56 ) {
+                put(v & 0xffffffffu, 32);
+                put(v >> 32, n - 32);
+                return;
+            }
+            acc |= v << bits;
+            bits += n;
+            int_block_codec::store_le64(buf + pos, acc);
+            pos += bits / 8;
+            acc >>= bits / 8 * 8;
+            bits %= 8;
+        }
+        std::size_t size() const { return pos + (bits ? 1 : 0); }
+    };
+
+    struct bit_reader {
+        explicit bit_reader(const std::uint8_t *buf)
+            :buf(buf)
+            ,pos(0)
+        {}
+
+        const std::uint8_t *buf;
+        std::size_t pos;
+
+        std::uint64_t get(std::size_t n) {
+            if ( n > 56 ) {
+                const std::uint64_t lo = get(32);
+                return lo | (get(n - 32) << 32);
+            }
+            const std::uint64_t v = (int_block_codec::load_le64(buf + pos / 8) >> (pos % 8))
+                & ((__YAS_SCAST(std::uint64_t, 1u) << n) - 1);
+            pos += n;
+            return v;
+        }
+    };
+
+    template<typename U>
+    static std::size_t leading_zeros(U v) {
+        std::size_t r = 0;
+        for ( U m = __YAS_SCAST(U, U{1} << (sizeof(U) * 8 - 1)); !(v & m); m >>= 1 ) { ++r; }
+        return r;
+    }
+    template<typename U>
+    static std::size_t trailing_zeros(U v) {
+        std::size_t r = 0;
+        for ( ; !(v & 1u); v >>= 1 ) { ++r; }
+        return r;
+    }
+
+    template<typename Archive, typename C>
+    static Archive& save(Archive &ar, const C &c, timeseries_floats) {
+        using V = typename C::value_type;
+        using U = typename storage_type<V>::type;
+        enum: std::size_t { width = sizeof(U) * 8, length_bits = (width == 64) ? 6 : 5 };
+
+        ar.write_seq_size(c.size());
+
+        std::uint8_t buf[max_chunk_bytes + padding];
+        bit_writer bw(buf);
+        xor_window<U> w;
+        U prev = 0;
+        std::size_t n = 0;
+        for ( const auto &it: c ) {
+            U u;
+            std::memcpy(&u, &it, sizeof(u));
+            const U x = __YAS_SCAST(U, u ^ prev);
+            prev = u;
+
+            if ( !x ) {
+                bw.put(0, 1);
+            } else {
+                const std::size_t lz = leading_zeros(x);
+                const std::size_t leading = (lz > 31) ? 31 : lz;
+                const std::size_t trailing = trailing_zeros(x);
+                if ( leading >= w.leading && trailing >= w.trailing ) {
+                    bw.put(1, 2);
+                    bw.put(x >> w.trailing, width - w.leading - w.trailing);
+                } else {
+                    const std::size_t length = width - leading - trailing;
+                    bw.put(3, 2);
+                    bw.put(leading, 5);
+                    bw.put(length - 1, length_bits);
+                    bw.put(x >> trailing, length);
+                    w.leading = leading;
+                    w.trailing = trailing;
+                }
+            }
+
+            if ( ++n == chunk_size ) {
+                write_chunk(ar, bw);
+                n = 0;
+            }
+        }
+        if ( n ) {
+            write_chunk(ar, bw);
+        }
+
+        return ar;
+    }
+
+    template<typename Archive>
+    static void write_chunk(Archive &ar, bit_writer &bw) {
+        const std::uint32_t bytes = __YAS_SCAST(std::uint32_t, bw.size());
+        ar & bytes;
+        ar.write(bw.buf, bytes);
+        bw = bit_writer(bw.buf);
+    }
+
+    template<typename Archive, typename C>
+    static Archive& load(Archive &ar, C &c, timeseries_floats) {
+        using V = typename C::value_type;
+        using U = typename storage_type<V>::type;
+        enum: std::size_t { width = sizeof(U) * 8, length_bits = (width == 64) ? 6 : 5 };
+
+        auto size = ar.read_seq_size();
+        c.resize(size);
+
+        std::uint8_t buf[max_chunk_bytes + padding];
+        xor_window<U> w;
+        U prev = 0;
+        auto it = c.begin();
+        while ( size ) {
+            const std::size_t n = (size < chunk_size) ? size : __YAS_SCAST(std::size_t, chunk_size);
+
+            std::uint32_t bytes = 0;
+            ar & bytes;
+            __YAS_THROW_READ_STORAGE_SIZE_ERROR(bytes > max_chunk_bytes);
+            ar.read(buf, bytes);
+            std::memset(buf + bytes, 0, padding);
+
+            bit_reader br(buf);
+            for ( std::size_t i = 0; i < n; ++i, ++it ) {
+                if ( br.get(1) ) {
+                    if ( br.get(1) ) {
+                        w.leading = __YAS_SCAST(std::size_t, br.get(5));
+                        const std::size_t length = __YAS_SCAST(std::size_t, br.get(length_bits)) + 1;
+                        __YAS_THROW_READ_STORAGE_SIZE_ERROR(w.leading + length > width);
+                        w.trailing = width - w.leading - length;
+                    }
+                    __YAS_THROW_READ_STORAGE_SIZE_ERROR(w.leading >= width);
+                    prev ^= __YAS_SCAST(U, br.get(width - w.leading - w.trailing) << w.trailing);
+                }
+                __YAS_THROW_READ_ERROR(br.pos > bytes * 8u);
+                std::memcpy(&(*it), &prev, sizeof(prev));
+            }
+            size -= n;
+        }
+
+        return ar;
+    }
+};
+
+/***************************************************************************/
+
+} // namespace detail
+} // namespace yas
+
+#endif // __yas__types__utility__timeseries_hpp
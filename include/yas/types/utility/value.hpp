@@ -38,6 +38,7 @@
 
 #include <yas/detail/type_traits/type_traits.hpp>
 #include <yas/detail/type_traits/serializer.hpp>
+#include <yas/detail/type_traits/serialized_size.hpp>
 #include <yas/detail/io/serialization_exceptions.hpp>
 #include <yas/detail/tools/json_tools.hpp>
 
@@ -71,8 +72,9 @@ struct serializer<
         __YAS_CONSTEXPR_IF ( F & yas::json ) {
             __YAS_CONSTEXPR_IF ( F & yas::compacted ) {
                 __YAS_THROW_IF_WRONG_JSON_CHARS(ar, "\"");
-                char key[1024];
-                const auto klen = json_read_key(ar, key, sizeof(key));
+                char buf[1024];
+                const char *key = buf;
+                const std::size_t klen = json_read_key(ar, buf, sizeof(buf), key);
                 if ( klen != v.klen || 0 != std::memcmp(key, v.key, v.klen) ) {
                     __YAS_THROW_UNEXPECTED_JSON_KEY("unexpected json key");
                 }
@@ -88,6 +90,16 @@ struct serializer<
 
 /***************************************************************************/
 
+template<std::size_t F, typename T>
+struct serialized_size_traits<F, value<T>, typename std::enable_if<(F & yas::binary)>::type>
+    :serialized_size_traits<
+         F
+        ,typename std::remove_cv<typename std::remove_reference<T>::type>::type
+    >
+{};
+
+/***************************************************************************/
+
 } // namespace detail
 } // namespace yas
 
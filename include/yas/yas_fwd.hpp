@@ -58,6 +58,7 @@ template<typename OS, std::size_t F>
 struct binary_oarchive;
 
 struct default_traits;
+struct fast_traits;
 struct std_traits;
 
 template<typename IS, std::size_t F, typename Traits>
@@ -74,6 +74,24 @@ bool array_test(std::ostream &log, const char *archive_type, const char *test_na
 		return false;
 	}
 
+	std::array<double, 37> arr9, arr10{{}};
+	for ( std::size_t i = 0; i < arr9.size(); ++i ) {
+		arr9[i] = static_cast<double>(i) / 4;
+	}
+
+	typename archive_traits::oarchive oa5;
+	archive_traits::ocreate(oa5, archive_type);
+	oa5 & YAS_OBJECT_NVP("obj", ("arr", arr9));
+
+	typename archive_traits::iarchive ia5;
+	archive_traits::icreate(ia5, oa5, archive_type);
+	ia5 & YAS_OBJECT_NVP("obj", ("arr", arr10));
+
+	if ( arr9 != arr10 ) {
+		YAS_TEST_REPORT(log, archive_type, test_name);
+		return false;
+	}
+
 #if defined(YAS_SERIALIZE_BOOST_TYPES)
 	boost::array<int, 10> arr5 = {
 		{0,1,2,3,4,5,6,7,8,9}
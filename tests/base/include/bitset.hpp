@@ -61,6 +61,33 @@ bool bitset_test(std::ostream &log, const char* archive_type, const char *test_n
 		return false;
 	}
 
+	std::bitset<1000> bs3, bs4;
+	for ( std::size_t i = 0; i < bs3.size(); i += 3 ) {
+		bs3[i] = 1;
+	}
+
+	typename archive_traits::oarchive oa2;
+	archive_traits::ocreate(oa2, archive_type);
+	oa2 & bs3;
+
+	// one bit per element
+	constexpr std::size_t flags = archive_traits::oarchive_type::flags();
+	if ( (flags & yas::binary) && !(flags & yas::compacted) &&
+		oa2.size() != archive_traits::oarchive_type::header_size() + sizeof(std::uint64_t) * 2 + bs3.size() / 8 )
+	{
+		YAS_TEST_REPORT(log, archive_type, test_name);
+		return false;
+	}
+
+	typename archive_traits::iarchive ia2;
+	archive_traits::icreate(ia2, oa2, archive_type);
+	ia2 & bs4;
+
+	if ( bs3 != bs4 ) {
+		YAS_TEST_REPORT(log, archive_type, test_name);
+		return false;
+	}
+
 	return true;
 }
 
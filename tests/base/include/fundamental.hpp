@@ -77,8 +77,8 @@ bool fundamental_test(std::ostream &log, const char *archive_type, const char *t
             +sizeof(i64max)
             +sizeof(u64max)
         ,binary_compacted_expected_size = 47
-        ,text_expected_size = 97
-        ,json_expected_size = 181
+        ,text_expected_size = 84
+        ,json_expected_size = 168
     };
 
     auto o0 = YAS_OBJECT(
@@ -159,6 +159,169 @@ bool fundamental_test(std::ostream &log, const char *archive_type, const char *t
         }
     }
 
+    // the fused runs of the variadic form produce the same bytes as one by one
+    {
+        typename archive_traits::oarchive oa2;
+        archive_traits::ocreate(oa2, archive_type);
+        oa2(b, c, uc, s, us, i, l, i64, u64, f, d, u64x, i64max, u64max);
+
+        typename archive_traits::oarchive oa3;
+        archive_traits::ocreate(oa3, archive_type);
+        oa3 & b & c & uc & s & us & i & l & i64 & u64 & f & d & u64x & i64max & u64max;
+
+        const yas::intrusive_buffer buf = oa3.get_intrusive_buffer();
+        if ( !oa2.compare(buf.data, buf.size) ) {
+            YAS_TEST_REPORT(log, archive_type, test_name);
+            return false;
+        }
+
+        // the bare json values have no separators
+        if ( archive_traits::oarchive_type::type() != yas::json ) {
+            b2 = false; c2 = 0; d2 = 0; u64max2 = 0;
+            typename archive_traits::iarchive ia;
+            archive_traits::icreate(ia, oa2, archive_type);
+            ia(b2, c2, uc2, s2, us2, i2, l2, i642, u642, f2, d2, u64x2, i64max2, u64max2);
+            if ( b != b2 || c != c2 || d != d2 || u64max != u64max2 ) {
+                YAS_TEST_REPORT(log, archive_type, test_name);
+                return false;
+            }
+        }
+    }
+
+    // the exponents, the subnormals and the limits survive the text forms exactly
+    {
+        const double ds[] = {
+             0.1, 1e-7, -2.5, 1e30, 1e-310, 5e-324, 2.2250738585072014e-308
+            ,1.7976931348623157e308, 123456.789e3, 3.141592653589793, 9007199254740993.
+        };
+        const float fs[] = {0.1f, 1e-7f, 1e30f, 3.4028235e38f, 1.4e-45f, 16777217.f};
+        for ( std::size_t idx = 0; idx < sizeof(ds)/sizeof(ds[0]); ++idx ) {
+            const double dv = ds[idx];
+            const float fv = fs[idx % (sizeof(fs)/sizeof(fs[0]))];
+            typename archive_traits::oarchive oa2;
+            archive_traits::ocreate(oa2, archive_type);
+            oa2 & YAS_OBJECT_NVP("obj", ("d", dv), ("f", fv));
+
+            double dv2{};
+            float fv2{};
+            typename archive_traits::iarchive ia;
+            archive_traits::icreate(ia, oa2, archive_type);
+            ia & YAS_OBJECT_NVP("obj", ("d", dv2), ("f", fv2));
+            if ( std::memcmp(&dv, &dv2, sizeof(dv)) != 0 || std::memcmp(&fv, &fv2, sizeof(fv)) != 0 ) {
+                YAS_TEST_REPORT(log, archive_type, test_name);
+                return false;
+            }
+        }
+    }
+
+    if ( archive_traits::oarchive_type::type() == yas::json ) {
+        static const char json[] = "{\"d\":1E+30,\"f\":-2.5e-3}";
+        double dv{};
+        float fv{};
+        yas::load<yas::mem|yas::json>(yas::intrusive_buffer(json, sizeof(json)-1), YAS_OBJECT_NVP("obj", ("d", dv), ("f", fv)));
+        if ( dv != 1e30 || fv != -2.5e-3f ) {
+            YAS_TEST_REPORT(log, archive_type, test_name);
+            return false;
+        }
+    }
+
+    // the long inputs are rounded by all of their digits
+    {
+        const std::string halfway = "9007199254740993." + std::string(600, '0');
+        const std::string above = halfway + "1";
+        const std::string fhalfway = "16777217." + std::string(200, '0');
+        const std::string fabove = fhalfway + "1";
+        if ( yas::detail::fast_atod<double>(halfway.data(), halfway.size()) != 9007199254740992.
+            || yas::detail::fast_atod<double>(above.data(), above.size()) != 9007199254740994.
+            || yas::detail::fast_atod<float>(fhalfway.data(), fhalfway.size()) != 16777216.f
+            || yas::detail::fast_atod<float>(fabove.data(), fabove.size()) != 16777218.f )
+        {
+            YAS_TEST_REPORT(log, archive_type, test_name);
+            return false;
+        }
+    }
+
+    if ( archive_traits::oarchive_type::type() == yas::json ) {
+        // the shortest representation, a float is not printed with the digits of a double
+        const double dv = 0.3, dmin = 5e-324;
+        const float fv = 0.3f, fmax = 3.4028235e38f;
+        yas::shared_buffer buf = yas::save<yas::mem|yas::json>(
+            YAS_OBJECT_NVP("obj", ("d", dv), ("m", dmin), ("f", fv), ("x", fmax))
+        );
+        static const char expected[] = "{\"d\":0.3,\"m\":5e-324,\"f\":0.3,\"x\":3.4028235e38}";
+        if ( buf.size != sizeof(expected)-1 || std::memcmp(buf.data.get(), expected, buf.size) != 0 ) {
+            YAS_TEST_REPORT(log, archive_type, test_name);
+            return false;
+        }
+    }
+
+    if ( archive_traits::oarchive_type::type() != yas::binary ) {
+        // the minimums have no positive counterpart
+        const std::int16_t i16 = std::numeric_limits<std::int16_t>::min();
+        const std::int32_t i32 = std::numeric_limits<std::int32_t>::min();
+        const std::int64_t i64 = std::numeric_limits<std::int64_t>::min();
+        const std::uint32_t u32 = 100000001;
+        std::int16_t i16r{};
+        std::int32_t i32r{};
+        std::int64_t i64r{};
+        std::uint32_t u32r{};
+
+        typename archive_traits::oarchive oa;
+        archive_traits::ocreate(oa, archive_type);
+        oa & YAS_OBJECT_NVP("obj", ("a", i16), ("b", i32), ("c", i64), ("d", u32));
+
+        typename archive_traits::iarchive ia;
+        archive_traits::icreate(ia, oa, archive_type);
+        ia & YAS_OBJECT_NVP("obj", ("a", i16r), ("b", i32r), ("c", i64r), ("d", u32r));
+        if ( i16 != i16r || i32 != i32r || i64 != i64r || u32 != u32r ) {
+            YAS_TEST_REPORT(log, archive_type, test_name);
+            return false;
+        }
+
+        char buf[32];
+        const std::size_t len = yas::default_traits::itoa(buf, sizeof(buf), i64);
+        if ( std::string(buf, len) != "-9223372036854775808" ) {
+            YAS_TEST_REPORT(log, archive_type, test_name);
+            return false;
+        }
+    }
+
+    if ( archive_traits::oarchive_type::type() == yas::json ) {
+        // the malformed and the out of range numbers are rejected
+        static const char *const jsons[] = {
+             "{\"v\":4294967296}"
+            ,"{\"v\":-1}"
+            ,"{\"v\":1-2}"
+            ,"{\"v\":-}"
+        };
+        for ( const char *json: jsons ) {
+            std::uint32_t v{};
+            bool thrown = false;
+            try {
+                yas::load<yas::mem|yas::json>(yas::intrusive_buffer(json, std::strlen(json)), YAS_OBJECT_NVP("obj", ("v", v)));
+            } catch (const yas::serialization_exception &) {
+                thrown = true;
+            }
+            if ( !thrown ) {
+                YAS_TEST_REPORT(log, archive_type, test_name);
+                return false;
+            }
+        }
+
+        static const char json[] = "{\"v\":-2147483649}";
+        std::int32_t v{};
+        bool thrown = false;
+        try {
+            yas::load<yas::mem|yas::json>(yas::intrusive_buffer(json, sizeof(json)-1), YAS_OBJECT_NVP("obj", ("v", v)));
+        } catch (const yas::serialization_exception &) {
+            thrown = true;
+        }
+        if ( !thrown ) {
+            YAS_TEST_REPORT(log, archive_type, test_name);
+            return false;
+        }
+    }
+
     if ( archive_traits::oarchive_type::type() == yas::json ) {
         yas::intrusive_buffer ibuf("1234", 2);
 
@@ -0,0 +1,118 @@
+
+// Copyright (c) 2010-2021 niXman (github dot nixman at pm dot me). All
+// rights reserved.
+//
+// This file is part of YAS(https://github.com/niXman/yas) project.
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//
+//
+// Boost Software License - Version 1.0 - August 17th, 2003
+//
+// Permission is hereby granted, free of charge, to any person or organization
+// obtaining a copy of the software and accompanying documentation covered by
+// this license (the "Software") to use, reproduce, display, distribute,
+// execute, and transmit the Software, and to prepare derivative works of the
+// Software, and to permit third-parties to whom the Software is furnished to
+// do so, all subject to the following:
+//
+// The copyright notices in the Software and this entire statement, including
+// the above license grant, this restriction and the following disclaimer,
+// must be included in all copies of the Software, in whole or in part, and
+// all derivative works of the Software, unless such copies or derivative
+// works are solely in the form of machine-executable object code generated by
+// a source language processor.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+// SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+// FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+
+
+#ifndef __yas__tests__base__include__interned_hpp
+#define __yas__tests__base__include__interned_hpp
+
+/***************************************************************************/
+
+template<typename archive_traits>
+bool interned_test(std::ostream &, const char *, const char *, std::false_type) {
+    return true;
+}
+
+template<typename archive_traits>
+bool interned_test(std::ostream &log, const char *archive_type, const char *test_name, std::true_type) {
+    constexpr std::size_t flags = (archive_traits::oarchive_type::flags() & ~(yas::mem|yas::file)) | yas::interned;
+
+    std::vector<std::string> v, vi;
+    for ( std::size_t i = 0; i < 1000; ++i ) {
+        v.push_back("host-" + std::to_string(i % 10) + ".example.com");
+    }
+    v.push_back(std::string(1000, 'x'));
+    v.push_back(std::string(1000, 'x'));
+    v.push_back(std::string());
+
+    yas::shared_buffer buf = yas::save<flags|yas::mem>(v);
+    if ( !yas::archive_is_interned(buf) ) {
+        YAS_TEST_REPORT(log, archive_type, test_name);
+        return false;
+    }
+    // every short string after the first ten is a one byte back-reference
+    if ( buf.size > yas::saved_size<flags & ~yas::interned>(v) / 5 ) {
+        YAS_TEST_REPORT(log, archive_type, test_name);
+        return false;
+    }
+    if ( yas::saved_size<flags>(v) != buf.size ) {
+        YAS_TEST_REPORT(log, archive_type, test_name);
+        return false;
+    }
+
+    yas::load<flags|yas::mem>(buf, vi);
+    if ( v != vi ) {
+        YAS_TEST_REPORT(log, archive_type, test_name);
+        return false;
+    }
+
+#if defined(YAS_SERIALIZE_BOOST_TYPES)
+    std::vector<boost::container::string> bv, bvi;
+    for ( std::size_t i = 0; i < 100; ++i ) {
+        bv.push_back(i % 2 ? "odd" : "even");
+    }
+
+    yas::shared_buffer buf2 = yas::save<flags|yas::mem>(bv);
+    yas::load<flags|yas::mem>(buf2, bvi);
+    if ( bv != bvi ) {
+        YAS_TEST_REPORT(log, archive_type, test_name);
+        return false;
+    }
+#endif // YAS_SERIALIZE_BOOST_TYPES
+
+    // the mode mismatch is detected by the header
+    bool thrown = false;
+    try {
+        yas::load<(flags & ~yas::interned)|yas::mem>(buf, vi);
+    } catch (const yas::io_exception &) {
+        thrown = true;
+    }
+    if ( !thrown ) {
+        YAS_TEST_REPORT(log, archive_type, test_name);
+        return false;
+    }
+
+    return true;
+}
+
+template<typename archive_traits>
+bool interned_test(std::ostream &log, const char *archive_type, const char *test_name) {
+    using is_binary = yas::is_binary_archive<typename archive_traits::oarchive_type>;
+
+    return interned_test<archive_traits>(log, archive_type, test_name, is_binary{});
+}
+
+/***************************************************************************/
+
+#endif // __yas__tests__base__include__interned_hpp
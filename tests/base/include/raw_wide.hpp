@@ -0,0 +1,133 @@
+
+// Copyright (c) 2010-2021 niXman (github dot nixman at pm dot me). All
+// rights reserved.
+//
+// This file is part of YAS(https://github.com/niXman/yas) project.
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//
+//
+// Boost Software License - Version 1.0 - August 17th, 2003
+//
+// Permission is hereby granted, free of charge, to any person or organization
+// obtaining a copy of the software and accompanying documentation covered by
+// this license (the "Software") to use, reproduce, display, distribute,
+// execute, and transmit the Software, and to prepare derivative works of the
+// Software, and to permit third-parties to whom the Software is furnished to
+// do so, all subject to the following:
+//
+// The copyright notices in the Software and this entire statement, including
+// the above license grant, this restriction and the following disclaimer,
+// must be included in all copies of the Software, in whole or in part, and
+// all derivative works of the Software, unless such copies or derivative
+// works are solely in the form of machine-executable object code generated by
+// a source language processor.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+// SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+// FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+
+
+#ifndef __yas__tests__base__include__raw_wide_hpp
+#define __yas__tests__base__include__raw_wide_hpp
+
+/***************************************************************************/
+
+template<typename archive_traits>
+bool raw_wide_test(std::ostream &, const char *, const char *, std::false_type) {
+    return true;
+}
+
+template<typename archive_traits>
+bool raw_wide_test(std::ostream &log, const char *archive_type, const char *test_name, std::true_type) {
+    constexpr std::size_t flags = (archive_traits::oarchive_type::flags() & ~(yas::mem|yas::file)) | yas::raw_wide;
+
+    std::vector<std::wstring> w = {
+         L""
+        ,L"I can eat glass and it doesn't hurt me."
+        ,L"我能吞下玻璃而不伤身体。"
+        ,L"Я могу есть стекло, оно мне не вредит."
+        ,L"\U0001F600 \U00010348"
+    };
+    std::u16string u = u"ça ne me fait pas de mal \U0001F600";
+
+    yas::shared_buffer buf = yas::save<flags|yas::mem>(w, u);
+    if ( !yas::archive_is_raw_wide(buf) ) {
+        YAS_TEST_REPORT(log, archive_type, test_name);
+        return false;
+    }
+    // the sizes and the code units, without the conversion to UTF-8
+    if ( !(flags & yas::compacted) ) {
+        std::size_t expected = yas::saved_size<flags>(std::vector<std::wstring>{}) + sizeof(std::uint64_t) + u.size() * 2;
+        for ( const auto &it: w ) {
+            expected += sizeof(std::uint64_t) + it.size() * sizeof(wchar_t);
+        }
+        if ( buf.size != expected ) {
+            YAS_TEST_REPORT(log, archive_type, test_name);
+            return false;
+        }
+    }
+
+    std::vector<std::wstring> wi;
+    std::u16string ui;
+    yas::load<flags|yas::mem>(buf, wi, ui);
+    if ( w != wi || u != ui ) {
+        YAS_TEST_REPORT(log, archive_type, test_name);
+        return false;
+    }
+
+#if defined(YAS_SERIALIZE_BOOST_TYPES)
+    boost::container::wstring bw = L"\U0001F600 boost", bwi;
+    yas::shared_buffer buf2 = yas::save<flags|yas::mem>(bw);
+    yas::load<flags|yas::mem>(buf2, bwi);
+    if ( bw != bwi ) {
+        YAS_TEST_REPORT(log, archive_type, test_name);
+        return false;
+    }
+#endif // YAS_SERIALIZE_BOOST_TYPES
+
+    // the units of the other width are converted
+    std::u16string u2;
+    yas::shared_buffer buf3 = yas::save<flags|yas::mem>(w.back());
+    yas::load<flags|yas::mem>(buf3, u2);
+    std::wstring w2;
+    yas::shared_buffer buf4 = yas::save<flags|yas::mem>(u);
+    yas::load<flags|yas::mem>(buf4, w2);
+    if ( sizeof(wchar_t) == 4 ) {
+        if ( u2 != u"\U0001F600 \U00010348" || w2 != L"ça ne me fait pas de mal \U0001F600" ) {
+            YAS_TEST_REPORT(log, archive_type, test_name);
+            return false;
+        }
+    }
+
+    // the mode mismatch is detected by the header
+    bool thrown = false;
+    try {
+        yas::load<(flags & ~yas::raw_wide)|yas::mem>(buf, wi, ui);
+    } catch (const yas::io_exception &) {
+        thrown = true;
+    }
+    if ( !thrown ) {
+        YAS_TEST_REPORT(log, archive_type, test_name);
+        return false;
+    }
+
+    return true;
+}
+
+template<typename archive_traits>
+bool raw_wide_test(std::ostream &log, const char *archive_type, const char *test_name) {
+    using is_binary = yas::is_binary_archive<typename archive_traits::oarchive_type>;
+
+    return raw_wide_test<archive_traits>(log, archive_type, test_name, is_binary{});
+}
+
+/***************************************************************************/
+
+#endif // __yas__tests__base__include__raw_wide_hpp
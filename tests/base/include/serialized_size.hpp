@@ -0,0 +1,147 @@
+
+// Copyright (c) 2010-2021 niXman (github dot nixman at pm dot me). All
+// rights reserved.
+//
+// This file is part of YAS(https://github.com/niXman/yas) project.
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//
+//
+// Boost Software License - Version 1.0 - August 17th, 2003
+//
+// Permission is hereby granted, free of charge, to any person or organization
+// obtaining a copy of the software and accompanying documentation covered by
+// this license (the "Software") to use, reproduce, display, distribute,
+// execute, and transmit the Software, and to prepare derivative works of the
+// Software, and to permit third-parties to whom the Software is furnished to
+// do so, all subject to the following:
+//
+// The copyright notices in the Software and this entire statement, including
+// the above license grant, this restriction and the following disclaimer,
+// must be included in all copies of the Software, in whole or in part, and
+// all derivative works of the Software, unless such copies or derivative
+// works are solely in the form of machine-executable object code generated by
+// a source language processor.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+// SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+// FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+
+#ifndef __yas__tests__base__include__serialized_size_hpp
+#define __yas__tests__base__include__serialized_size_hpp
+
+/***************************************************************************/
+
+static_assert(yas::max_serialized_size<yas::binary|yas::no_header, std::uint32_t>() == 4, "");
+static_assert(yas::max_serialized_size<yas::binary|yas::no_header|yas::compacted, std::uint32_t>() == 5, "");
+static_assert(yas::max_serialized_size<yas::binary|yas::no_header, std::array<std::uint8_t, 3>>() == 8+3, "");
+static_assert(yas::max_serialized_size<yas::binary|yas::no_header|yas::compacted, std::array<std::uint8_t, 3>>() == 1+3, "");
+static_assert(yas::max_serialized_size<yas::binary, std::pair<bool, double>>() == 7+1+8, "");
+
+template<typename archive_traits>
+bool serialized_size_test(std::ostream &, const char *, const char *, std::false_type) {
+    return true;
+}
+
+template<typename archive_traits>
+bool serialized_size_test(std::ostream &log, const char *archive_type, const char *test_name, std::true_type) {
+    constexpr std::size_t flags = archive_traits::oarchive_type::flags();
+    constexpr bool compacted = (flags & yas::compacted);
+
+    {
+        using type = std::tuple<
+             std::uint32_t
+            ,double
+            ,std::array<std::uint16_t, 3>
+            ,std::pair<bool, std::int64_t>
+            ,std::chrono::seconds
+        >;
+        type v{33, 3.14, {{1, 2, 3}}, {true, -1}, std::chrono::seconds{1024}};
+
+        constexpr std::size_t max = yas::max_serialized_size<flags, type>();
+        const std::size_t saved = yas::saved_size<flags>(v);
+        if ( compacted ? saved > max : saved != max ) {
+            YAS_TEST_REPORT(log, archive_type, test_name);
+            return false;
+        }
+        if ( yas::serialized_size<flags>(v) != saved ) {
+            YAS_TEST_REPORT(log, archive_type, test_name);
+            return false;
+        }
+
+        yas::shared_buffer buf = yas::save<flags|yas::mem>(v);
+        if ( buf.size != saved ) {
+            YAS_TEST_REPORT(log, archive_type, test_name);
+            return false;
+        }
+
+        type vv{};
+        yas::load<flags|yas::mem>(buf, vv);
+        if ( v != vv ) {
+            YAS_TEST_REPORT(log, archive_type, test_name);
+            return false;
+        }
+    }
+    {
+        std::uint16_t u16 = 300;
+        std::vector<std::string> strs{"1", "22", "333"};
+        std::string str = "4444";
+
+        const std::size_t saved = yas::saved_size<flags>(u16, strs, str);
+        if ( yas::serialized_size<flags>(u16, strs, str) != saved ) {
+            YAS_TEST_REPORT(log, archive_type, test_name);
+            return false;
+        }
+
+        auto o = YAS_OBJECT(nullptr, u16, str);
+        if ( yas::serialized_size<flags>(o) != yas::saved_size<flags>(o) ) {
+            YAS_TEST_REPORT(log, archive_type, test_name);
+            return false;
+        }
+    }
+    {
+        std::vector<std::pair<std::int32_t, std::uint16_t>> v{{1, 2}, {-3, 4}, {500, 600}}, vv;
+        std::list<std::uint32_t> l{7, 8, 9}, ll;
+        std::array<std::tuple<std::uint8_t, double>, 2> a{{std::make_tuple(1, 1.5), std::make_tuple(2, 2.5)}}, aa;
+
+        const std::size_t saved = yas::saved_size<flags>(v, l, a);
+        yas::mem_ostream os;
+        yas::binary_oarchive<yas::mem_ostream, flags> oa(os);
+        oa(v, l, a);
+        if ( os.get_intrusive_buffer().size != saved ) {
+            YAS_TEST_REPORT(log, archive_type, test_name);
+            return false;
+        }
+
+        yas::shared_buffer buf = yas::save_exact<flags|yas::mem>(v, l, a);
+        if ( buf.size != saved ) {
+            YAS_TEST_REPORT(log, archive_type, test_name);
+            return false;
+        }
+
+        yas::load<flags|yas::mem>(buf, vv, ll, aa);
+        if ( v != vv || l != ll || a != aa ) {
+            YAS_TEST_REPORT(log, archive_type, test_name);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+template<typename archive_traits>
+bool serialized_size_test(std::ostream &log, const char *archive_type, const char *test_name) {
+    using is_binary = yas::is_binary_archive<typename archive_traits::oarchive_type>;
+
+    return serialized_size_test<archive_traits>(log, archive_type, test_name, is_binary{});
+}
+
+/***************************************************************************/
+
+#endif // __yas__tests__base__include__serialized_size_hpp
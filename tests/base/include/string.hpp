@@ -86,6 +86,70 @@ bool string_test(std::ostream &log, const char *archive_type, const char *test_n
             return false;
         }
     }
+    if ( archive_traits::oarchive_type::flags() & yas::json ) {
+        // the plain runs of various lengths between the escapes and the multi-byte chars
+        std::string s, ss;
+        for ( std::size_t i = 0; i < 500; ++i ) {
+            s += __YAS_SCAST(char, 'a' + i % 26);
+            if ( i % 17 == 0 ) s += "\"\\";
+            if ( i % 29 == 0 ) s += "\xc3\xa9\xe2\x82\xac\xf0\x9f\x98\x80";
+            if ( i % 41 == 0 ) s += "\t\x01";
+            if ( i % 53 == 0 ) s += '\0';
+        }
+
+        typename archive_traits::oarchive oa;
+        archive_traits::ocreate(oa, archive_type);
+        oa & YAS_OBJECT_NVP("obj", ("s", s));
+
+        typename archive_traits::iarchive ia;
+        archive_traits::icreate(ia, oa, archive_type);
+        ia & YAS_OBJECT_NVP("obj", ("s", ss));
+
+        if ( ss != s ) {
+            YAS_TEST_REPORT(log, archive_type, test_name);
+            return false;
+        }
+    }
+    if ( archive_traits::oarchive_type::flags() & yas::json ) {
+        // the escapes are written inline, the embedded NULs are escaped too
+        const std::string s("a\"b\\c\nd\x1f" "e\0f", 11);
+        yas::shared_buffer buf = yas::save<yas::mem|yas::json>(YAS_OBJECT_NVP("obj", ("s", s)));
+        static const char expected[] = "{\"s\":\"a\\\"b\\\\c\\nd\\u001fe\\u0000f\"}";
+        if ( buf.size != sizeof(expected)-1 || std::memcmp(buf.data.get(), expected, buf.size) != 0 ) {
+            YAS_TEST_REPORT(log, archive_type, test_name);
+            return false;
+        }
+    }
+    if ( archive_traits::oarchive_type::flags() & yas::json ) {
+        static const char json[] = "{\"s\":\"\\u00e9-\\ud83d\\ude00-\\u0041\"}";
+        std::string ss;
+        yas::load<yas::mem|yas::json>(yas::intrusive_buffer(json, sizeof(json)-1), YAS_OBJECT_NVP("obj", ("s", ss)));
+        if ( ss != "\xc3\xa9-\xf0\x9f\x98\x80-A" ) {
+            YAS_TEST_REPORT(log, archive_type, test_name);
+            return false;
+        }
+    }
+    if ( archive_traits::oarchive_type::flags() & yas::json ) {
+        // ill-formed UTF-8: a surrogate, an overlong form, a cut sequence
+        const char *invalid[] = {
+             "{\"s\":\"0123456789abcdef\xed\xa0\x80\"}"
+            ,"{\"s\":\"\xc0\xaf" "0123456789abcdef\"}"
+            ,"{\"s\":\"0123456789abcde\xe2\x82\"}"
+        };
+        for ( const char *json: invalid ) {
+            std::string ss;
+            bool thrown = false;
+            try {
+                yas::load<yas::mem|yas::json>(yas::intrusive_buffer(json, std::strlen(json)), YAS_OBJECT_NVP("obj", ("s", ss)));
+            } catch (const yas::serialization_exception &) {
+                thrown = true;
+            }
+            if ( !thrown ) {
+                YAS_TEST_REPORT(log, archive_type, test_name);
+                return false;
+            }
+        }
+    }
 
 	return true;
 }
@@ -58,7 +58,20 @@ bool u16string_test(std::ostream &log, const char *archive_type, const char *tes
 		u"Мога да ям стъкло, то не ми вреди.", // bg
 		u"Cam yiyebilirim, bana zararı dokunmaz.", // tr
 		u"Je peux manger du verre, ça ne me fait pas de mal.", // fr
+		u"\U0001F600 smile \U0001F680 rocket \U00010348", // surrogate pairs
 	};
+	// lone surrogates are kept as WTF-8, which the JSON reader rejects
+	if ( !(archive_traits::oarchive_type::flags() & yas::json) ) {
+		u16s_collection.push_back(std::u16string(1, u'\xD800') + u"lone surrogates" + std::u16string(1, u'\xDC00'));
+	}
+	// ASCII runs with multi-byte units and pairs at the ends of the SIMD blocks
+	std::u16string mixed;
+	for ( std::size_t i = 0; i < 300; ++i ) {
+		mixed += (i % 37 == 0) ? u'\x44F' : (i % 31 == 0) ? u'\x20AC' : char16_t(u'a' + i % 26);
+		if ( i % 43 == 0 ) mixed += u"\U0001F600";
+	}
+	u16s_collection.push_back(mixed);
+	u16s_collection.push_back(std::u16string(1000, u'x'));
 
 	for (auto& u16s : u16s_collection) {
 		std::u16string u16ss;
@@ -38,6 +38,103 @@
 
 /***************************************************************************/
 
+template<typename archive_traits>
+bool vector_int_blocks_test(std::ostream &, const char *, const char *, std::false_type) {
+    return true;
+}
+
+template<typename archive_traits>
+bool vector_int_blocks_test(std::ostream &log, const char *archive_type, const char *test_name, std::true_type) {
+    constexpr std::size_t flags = (archive_traits::oarchive_type::flags() & ~(yas::mem|yas::file)) | yas::int_blocks;
+
+    // small values, a narrow range of large values, and the full range
+    std::vector<std::uint32_t> ids(300), idsi;
+    std::vector<std::int32_t> vs(300), vsi;
+    std::vector<std::uint64_t> vu(300), vui;
+    for ( std::size_t i = 0; i < ids.size(); ++i ) {
+        ids[i] = static_cast<std::uint32_t>(i % 13);
+        vs[i] = static_cast<std::int32_t>(1000000 - static_cast<std::int32_t>(i % 7) * 3);
+        vu[i] = (i % 3) ? static_cast<std::uint64_t>(i) << (i % 64) : ~static_cast<std::uint64_t>(i);
+    }
+    yas::shared_buffer buf = yas::save<flags|yas::mem>(ids);
+    if ( !yas::archive_is_int_blocks(buf) ) {
+        YAS_TEST_REPORT(log, archive_type, test_name);
+        return false;
+    }
+    // the elements are bit-packed
+    if ( (flags & yas::compacted) && buf.size > archive_traits::oarchive_type::header_size() + 8 + ids.size() / 2 + 16 ) {
+        YAS_TEST_REPORT(log, archive_type, test_name);
+        return false;
+    }
+
+    yas::shared_buffer buf2 = yas::save<flags|yas::mem>(ids, vs, vu);
+    yas::load<flags|yas::mem>(buf2, idsi, vsi, vui);
+    if ( ids != idsi || vs != vsi || vu != vui ) {
+        YAS_TEST_REPORT(log, archive_type, test_name);
+        return false;
+    }
+
+    // the mode mismatch is detected by the header
+    bool thrown = false;
+    try {
+        yas::load<(flags & ~yas::int_blocks)|yas::mem>(buf2, idsi, vsi, vui);
+    } catch (const yas::io_exception &) {
+        thrown = true;
+    }
+    if ( !thrown ) {
+        YAS_TEST_REPORT(log, archive_type, test_name);
+        return false;
+    }
+
+    return true;
+}
+
+template<typename archive_traits>
+bool vector_packed_bools_test(std::ostream &, const char *, const char *, std::false_type) {
+    return true;
+}
+
+template<typename archive_traits>
+bool vector_packed_bools_test(std::ostream &log, const char *archive_type, const char *test_name, std::true_type) {
+    constexpr std::size_t flags = (archive_traits::oarchive_type::flags() & ~(yas::mem|yas::file)) | yas::packed_bools;
+
+    std::vector<bool> bits(1001), bitsi;
+    for ( std::size_t i = 0; i < bits.size(); i += 3 ) {
+        bits[i] = true;
+    }
+    yas::shared_buffer buf = yas::save<flags|yas::mem>(bits);
+    if ( !yas::archive_is_packed_bools(buf) ) {
+        YAS_TEST_REPORT(log, archive_type, test_name);
+        return false;
+    }
+    if ( !(flags & yas::compacted) &&
+        buf.size != archive_traits::oarchive_type::header_size() + sizeof(std::uint64_t) + (bits.size() + 7) / 8 )
+    {
+        YAS_TEST_REPORT(log, archive_type, test_name);
+        return false;
+    }
+
+    yas::load<flags|yas::mem>(buf, bitsi);
+    if ( bits != bitsi ) {
+        YAS_TEST_REPORT(log, archive_type, test_name);
+        return false;
+    }
+
+    // the mode mismatch is detected by the header
+    bool thrown = false;
+    try {
+        yas::load<(flags & ~yas::packed_bools)|yas::mem>(buf, bitsi);
+    } catch (const yas::io_exception &) {
+        thrown = true;
+    }
+    if ( !thrown ) {
+        YAS_TEST_REPORT(log, archive_type, test_name);
+        return false;
+    }
+
+    return true;
+}
+
 template<typename archive_traits>
 bool vector_test(std::ostream &log, const char *archive_type, const char *test_name) {
 	std::vector<std::uint32_t> v, vv;
@@ -93,6 +190,76 @@ bool vector_test(std::ostream &log, const char *archive_type, const char *test_n
         return false;
     }
 
+    std::vector<std::uint16_t> v16(77), v16i;
+    std::vector<std::int64_t> v64(77), v64i;
+    std::vector<float> vf(77), vfi;
+    std::vector<double> vd(77), vdi;
+    for ( std::size_t i = 0; i < v16.size(); ++i ) {
+        v16[i] = static_cast<std::uint16_t>(i * 0x0102u);
+        v64[i] = -static_cast<std::int64_t>(i * 0x0102030405060708ull);
+        vf[i] = static_cast<float>(i) / 4;
+        vd[i] = static_cast<double>(i) / 8;
+    }
+    typename archive_traits::oarchive oa4;
+    archive_traits::ocreate(oa4, archive_type);
+    oa4 & v16 & v64 & vf & vd;
+
+    constexpr std::size_t flags = archive_traits::oarchive_type::flags();
+    if ( (flags & yas::binary) && !(flags & yas::compacted) ) {
+        // the first non-zero element follows the header, the size and the zero element
+        const std::uint8_t *p = reinterpret_cast<const std::uint8_t *>(oa4.get_intrusive_buffer().data)
+            + archive_traits::oarchive_type::header_size() + sizeof(std::uint64_t) + sizeof(std::uint16_t);
+        const std::uint8_t exp_le[] = {0x02, 0x01}, exp_be[] = {0x01, 0x02};
+        if ( 0 != std::memcmp(p, oa4.is_big_endian() ? exp_be : exp_le, 2) ) {
+            YAS_TEST_REPORT(log, archive_type, test_name);
+            return false;
+        }
+    }
+
+    typename archive_traits::iarchive ia4;
+    archive_traits::icreate(ia4, oa4, archive_type);
+    ia4 & v16i & v64i & vfi & vdi;
+
+    if ( v16 != v16i || v64 != v64i || vf != vfi || vd != vdi ) {
+        YAS_TEST_REPORT(log, archive_type, test_name);
+        return false;
+    }
+
+    // the arrays of integers of compacted archives are encoded by the blocks
+    // only with 'yas::int_blocks'
+    if ( !vector_int_blocks_test<archive_traits>(log, archive_type, test_name, yas::is_binary_archive<typename archive_traits::oarchive_type>{}) ) {
+        return false;
+    }
+
+    std::vector<bool> bits(1001), bitsi;
+    for ( std::size_t i = 0; i < bits.size(); i += 3 ) {
+        bits[i] = true;
+    }
+    typename archive_traits::oarchive oa6;
+    archive_traits::ocreate(oa6, archive_type);
+    oa6 & bits;
+    // one byte per element
+    if ( (flags & yas::binary) && !(flags & yas::compacted) &&
+        oa6.size() != archive_traits::oarchive_type::header_size() + sizeof(std::uint64_t) + bits.size() )
+    {
+        YAS_TEST_REPORT(log, archive_type, test_name);
+        return false;
+    }
+
+    typename archive_traits::iarchive ia6;
+    archive_traits::icreate(ia6, oa6, archive_type);
+    ia6 & bitsi;
+
+    if ( bits != bitsi ) {
+        YAS_TEST_REPORT(log, archive_type, test_name);
+        return false;
+    }
+
+    // one bit per element with 'yas::packed_bools'
+    if ( !vector_packed_bools_test<archive_traits>(log, archive_type, test_name, yas::is_binary_archive<typename archive_traits::oarchive_type>{}) ) {
+        return false;
+    }
+
 	return true;
 }
 
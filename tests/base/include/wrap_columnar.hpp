@@ -0,0 +1,117 @@
+
+// Copyright (c) 2010-2021 niXman (github dot nixman at pm dot me). All
+// rights reserved.
+//
+// This file is part of YAS(https://github.com/niXman/yas) project.
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//
+//
+// Boost Software License - Version 1.0 - August 17th, 2003
+//
+// Permission is hereby granted, free of charge, to any person or organization
+// obtaining a copy of the software and accompanying documentation covered by
+// this license (the "Software") to use, reproduce, display, distribute,
+// execute, and transmit the Software, and to prepare derivative works of the
+// Software, and to permit third-parties to whom the Software is furnished to
+// do so, all subject to the following:
+//
+// The copyright notices in the Software and this entire statement, including
+// the above license grant, this restriction and the following disclaimer,
+// must be included in all copies of the Software, in whole or in part, and
+// all derivative works of the Software, unless such copies or derivative
+// works are solely in the form of machine-executable object code generated by
+// a source language processor.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+// SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+// FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+
+
+#ifndef __yas__tests__base__include__wrap_columnar_hpp
+#define __yas__tests__base__include__wrap_columnar_hpp
+
+/***************************************************************************/
+
+struct columnar_trade {
+    std::uint64_t id;
+    double price;
+    std::int32_t qty;
+    bool buy;
+    std::string sym;
+
+    bool operator== (const columnar_trade &r) const {
+        return id == r.id && price == r.price && qty == r.qty && buy == r.buy && sym == r.sym;
+    }
+
+    YAS_DEFINE_STRUCT_SERIALIZE("columnar_trade", id, price, qty, buy, sym);
+};
+
+struct columnar_point {
+    std::int16_t x;
+    std::int16_t y;
+
+    bool operator== (const columnar_point &r) const { return x == r.x && y == r.y; }
+};
+
+template<typename Ar>
+void serialize(Ar &ar, columnar_point &p) {
+    ar & YAS_OBJECT_STRUCT(nullptr, p, x, y);
+}
+
+template<typename archive_traits>
+bool wrap_columnar_test(std::ostream &log, const char *archive_type, const char *test_name) {
+    std::vector<columnar_trade> v, vi;
+    for ( std::uint32_t i = 0; i < 5000; ++i ) {
+        v.push_back({1000000u + i, 100. + (i % 64) / 4., __YAS_SCAST(std::int32_t, i % 300) - 150, (i % 3) == 0, (i % 2) ? "AAA" : "BBBB"});
+    }
+    std::vector<columnar_point> p, pi;
+    for ( std::int16_t i = 0; i < 100; ++i ) {
+        p.push_back({i, __YAS_SCAST(std::int16_t, -i)});
+    }
+    std::vector<columnar_trade> e, ei;
+
+    typename archive_traits::oarchive oa;
+    archive_traits::ocreate(oa, archive_type);
+    oa & YAS_OBJECT_NVP("obj", ("v", yas::columnar(v)), ("p", yas::columnar(p)), ("e", yas::columnar(e)));
+
+    typename archive_traits::oarchive oa2;
+    archive_traits::ocreate(oa2, archive_type);
+    oa2 & YAS_OBJECT_NVP("obj", ("v", v), ("p", p), ("e", e));
+
+    // the compactable columns are encoded by the blocks
+    if ( yas::is_binary_archive<typename archive_traits::oarchive_type>::value
+        && (archive_traits::oarchive_type::flags() & yas::compacted) )
+    {
+        if ( oa.size() >= oa2.size() ) {
+            YAS_TEST_REPORT(log, archive_type, test_name);
+            return false;
+        }
+    } else if ( !yas::is_binary_archive<typename archive_traits::oarchive_type>::value
+        && oa.size() != oa2.size() )
+    {
+        YAS_TEST_REPORT(log, archive_type, test_name);
+        return false;
+    }
+
+    typename archive_traits::iarchive ia;
+    archive_traits::icreate(ia, oa, archive_type);
+    ia & YAS_OBJECT_NVP("obj", ("v", yas::columnar(vi)), ("p", yas::columnar(pi)), ("e", yas::columnar(ei)));
+
+    if ( v != vi || p != pi || !ei.empty() ) {
+        YAS_TEST_REPORT(log, archive_type, test_name);
+        return false;
+    }
+
+    return true;
+}
+
+/***************************************************************************/
+
+#endif // __yas__tests__base__include__wrap_columnar_hpp
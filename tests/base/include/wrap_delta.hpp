@@ -0,0 +1,106 @@
+
+// Copyright (c) 2010-2021 niXman (github dot nixman at pm dot me). All
+// rights reserved.
+//
+// This file is part of YAS(https://github.com/niXman/yas) project.
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//
+//
+// Boost Software License - Version 1.0 - August 17th, 2003
+//
+// Permission is hereby granted, free of charge, to any person or organization
+// obtaining a copy of the software and accompanying documentation covered by
+// this license (the "Software") to use, reproduce, display, distribute,
+// execute, and transmit the Software, and to prepare derivative works of the
+// Software, and to permit third-parties to whom the Software is furnished to
+// do so, all subject to the following:
+//
+// The copyright notices in the Software and this entire statement, including
+// the above license grant, this restriction and the following disclaimer,
+// must be included in all copies of the Software, in whole or in part, and
+// all derivative works of the Software, unless such copies or derivative
+// works are solely in the form of machine-executable object code generated by
+// a source language processor.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+// SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+// FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+
+
+#ifndef __yas__tests__base__include__wrap_delta_hpp
+#define __yas__tests__base__include__wrap_delta_hpp
+
+/***************************************************************************/
+
+template<typename archive_traits>
+bool wrap_delta_test(std::ostream &log, const char *archive_type, const char *test_name) {
+    std::set<std::uint64_t> s, si;
+    for ( std::uint64_t i = 0; i < 1000; ++i ) {
+        s.insert(1000000 + i * 7 + (i % 3));
+    }
+    std::map<std::int32_t, std::string> m, mi;
+    for ( std::int32_t i = 0; i < 300; ++i ) {
+        m.emplace(i * 5 - 700, std::to_string(i));
+    }
+
+    typename archive_traits::oarchive oa;
+    archive_traits::ocreate(oa, archive_type);
+    oa & YAS_OBJECT_NVP("obj", ("s", yas::delta(s)), ("m", yas::delta(m)));
+
+    typename archive_traits::oarchive oa2;
+    archive_traits::ocreate(oa2, archive_type);
+    oa2 & YAS_OBJECT_NVP("obj", ("s", s), ("m", m));
+
+    // the keys are stored as deltas in binary archives only
+    if ( yas::is_binary_archive<typename archive_traits::oarchive_type>::value ) {
+        if ( oa.size() * 2 > oa2.size() ) {
+            YAS_TEST_REPORT(log, archive_type, test_name);
+            return false;
+        }
+    } else if ( oa.size() != oa2.size() ) {
+        YAS_TEST_REPORT(log, archive_type, test_name);
+        return false;
+    }
+
+    typename archive_traits::iarchive ia;
+    archive_traits::icreate(ia, oa, archive_type);
+    ia & YAS_OBJECT_NVP("obj", ("s", yas::delta(si)), ("m", yas::delta(mi)));
+
+    if ( s != si || m != mi ) {
+        YAS_TEST_REPORT(log, archive_type, test_name);
+        return false;
+    }
+
+#if defined(YAS_SERIALIZE_BOOST_TYPES)
+    boost::container::flat_map<std::uint32_t, double> fm, fmi;
+    for ( std::uint32_t i = 0; i < 200; ++i ) {
+        fm.emplace(i * i, i / 4.);
+    }
+
+    typename archive_traits::oarchive oa3;
+    archive_traits::ocreate(oa3, archive_type);
+    oa3 & YAS_OBJECT_NVP("obj", ("fm", yas::delta(fm)));
+
+    typename archive_traits::iarchive ia3;
+    archive_traits::icreate(ia3, oa3, archive_type);
+    ia3 & YAS_OBJECT_NVP("obj", ("fm", yas::delta(fmi)));
+
+    if ( fm != fmi ) {
+        YAS_TEST_REPORT(log, archive_type, test_name);
+        return false;
+    }
+#endif // YAS_SERIALIZE_BOOST_TYPES
+
+    return true;
+}
+
+/***************************************************************************/
+
+#endif // __yas__tests__base__include__wrap_delta_hpp
@@ -0,0 +1,116 @@
+
+// Copyright (c) 2010-2021 niXman (github dot nixman at pm dot me). All
+// rights reserved.
+//
+// This file is part of YAS(https://github.com/niXman/yas) project.
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//
+//
+// Boost Software License - Version 1.0 - August 17th, 2003
+//
+// Permission is hereby granted, free of charge, to any person or organization
+// obtaining a copy of the software and accompanying documentation covered by
+// this license (the "Software") to use, reproduce, display, distribute,
+// execute, and transmit the Software, and to prepare derivative works of the
+// Software, and to permit third-parties to whom the Software is furnished to
+// do so, all subject to the following:
+//
+// The copyright notices in the Software and this entire statement, including
+// the above license grant, this restriction and the following disclaimer,
+// must be included in all copies of the Software, in whole or in part, and
+// all derivative works of the Software, unless such copies or derivative
+// works are solely in the form of machine-executable object code generated by
+// a source language processor.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+// SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+// FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+
+
+#ifndef __yas__tests__base__include__wrap_narrow_hpp
+#define __yas__tests__base__include__wrap_narrow_hpp
+
+/***************************************************************************/
+
+template<typename archive_traits, typename T>
+bool wrap_narrow_roundtrip(const char *archive_type, const T &v) {
+    typename archive_traits::oarchive oa;
+    archive_traits::ocreate(oa, archive_type);
+    oa & yas::narrow(v);
+
+    T vi{};
+    typename archive_traits::iarchive ia;
+    archive_traits::icreate(ia, oa, archive_type);
+    ia & yas::narrow(vi);
+
+    // bitwise, for the signed zeros and the NaNs
+    return std::memcmp(&v, &vi, sizeof(T)) == 0;
+}
+
+template<typename archive_traits>
+bool wrap_narrow_test(std::ostream &log, const char *archive_type, const char *test_name) {
+    std::vector<double> d = {
+         0., -0., 1., -1., 91., -92., 183., 1e6, -1e6, 9007199254740992., -9007199254740992.
+        ,18014398509481984., 100.25, -0.5, 0.1, -3.14159265358979, 1e30, 1e-310
+    };
+    std::vector<float> f = {0.f, -0.f, 7.f, -100000.f, 16777216.f, 0.75f, 3.3f, 1e30f};
+    if ( yas::is_binary_archive<typename archive_traits::oarchive_type>::value ) {
+        d.push_back(std::numeric_limits<double>::infinity());
+        d.push_back(-std::numeric_limits<double>::infinity());
+        d.push_back(std::numeric_limits<double>::quiet_NaN());
+        f.push_back(std::numeric_limits<float>::infinity());
+        f.push_back(std::numeric_limits<float>::quiet_NaN());
+    }
+
+    for ( const auto &it: d ) {
+        if ( !wrap_narrow_roundtrip<archive_traits>(archive_type, it) ) {
+            YAS_TEST_REPORT(log, archive_type, test_name);
+            return false;
+        }
+    }
+    for ( const auto &it: f ) {
+        if ( !wrap_narrow_roundtrip<archive_traits>(archive_type, it) ) {
+            YAS_TEST_REPORT(log, archive_type, test_name);
+            return false;
+        }
+    }
+
+    // the half-tick prices takes the one byte integers and the floats
+    std::vector<double> prices;
+    for ( std::size_t i = 0; i < 1000; ++i ) {
+        prices.push_back(10. + __YAS_SCAST(double, i % 40) * 0.5);
+    }
+
+    typename archive_traits::oarchive oa2;
+    archive_traits::ocreate(oa2, archive_type);
+    typename archive_traits::oarchive oa3;
+    archive_traits::ocreate(oa3, archive_type);
+    for ( const auto &it: prices ) {
+        oa2 & yas::narrow(it);
+        oa3 & it;
+    }
+
+    constexpr std::size_t flags = archive_traits::oarchive_type::flags();
+    if ( (flags & yas::binary) && (flags & yas::compacted) ) {
+        if ( oa2.size() * 2 > oa3.size() ) {
+            YAS_TEST_REPORT(log, archive_type, test_name);
+            return false;
+        }
+    } else if ( oa2.size() != oa3.size() ) {
+        YAS_TEST_REPORT(log, archive_type, test_name);
+        return false;
+    }
+
+    return true;
+}
+
+/***************************************************************************/
+
+#endif // __yas__tests__base__include__wrap_narrow_hpp
@@ -0,0 +1,157 @@
+
+// Copyright (c) 2010-2021 niXman (github dot nixman at pm dot me). All
+// rights reserved.
+//
+// This file is part of YAS(https://github.com/niXman/yas) project.
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//
+//
+// Boost Software License - Version 1.0 - August 17th, 2003
+//
+// Permission is hereby granted, free of charge, to any person or organization
+// obtaining a copy of the software and accompanying documentation covered by
+// this license (the "Software") to use, reproduce, display, distribute,
+// execute, and transmit the Software, and to prepare derivative works of the
+// Software, and to permit third-parties to whom the Software is furnished to
+// do so, all subject to the following:
+//
+// The copyright notices in the Software and this entire statement, including
+// the above license grant, this restriction and the following disclaimer,
+// must be included in all copies of the Software, in whole or in part, and
+// all derivative works of the Software, unless such copies or derivative
+// works are solely in the form of machine-executable object code generated by
+// a source language processor.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+// SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+// FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+
+
+#ifndef __yas__tests__base__include__wrap_presence_hpp
+#define __yas__tests__base__include__wrap_presence_hpp
+
+/***************************************************************************/
+
+struct presence_event {
+    std::uint32_t id;
+    std::int32_t code;
+    std::string source;
+    std::vector<std::uint16_t> tags;
+    double value;
+#if defined(YAS_SERIALIZE_BOOST_TYPES)
+    boost::optional<std::string> note;
+    boost::optional<std::int64_t> ts;
+#endif // YAS_SERIALIZE_BOOST_TYPES
+
+    presence_event()
+        :id{}
+        ,code{}
+        ,source{}
+        ,tags{}
+        ,value{}
+    {}
+
+    bool operator== (const presence_event &r) const {
+        return id == r.id && code == r.code && source == r.source && tags == r.tags && value == r.value
+#if defined(YAS_SERIALIZE_BOOST_TYPES)
+            && note == r.note && ts == r.ts
+#endif // YAS_SERIALIZE_BOOST_TYPES
+        ;
+    }
+
+    template<typename Ar>
+    void serialize(Ar &ar) {
+        ar & yas::elide_defaults(YAS_OBJECT("presence_event", id, code, source, tags, value
+#if defined(YAS_SERIALIZE_BOOST_TYPES)
+            ,note, ts
+#endif // YAS_SERIALIZE_BOOST_TYPES
+        ));
+    }
+};
+
+template<typename archive_traits>
+bool wrap_presence_test(std::ostream &log, const char *archive_type, const char *test_name) {
+    presence_event e0, e1, i0, i1;
+    e1.id = 33;
+    e1.source = "src";
+    e1.tags = {1, 2, 3};
+#if defined(YAS_SERIALIZE_BOOST_TYPES)
+    e1.ts = 1234567;
+#endif // YAS_SERIALIZE_BOOST_TYPES
+
+    typename archive_traits::oarchive oa;
+    archive_traits::ocreate(oa, archive_type);
+    oa & e0 & e1;
+
+    typename archive_traits::iarchive ia;
+    archive_traits::icreate(ia, oa, archive_type);
+    ia & i0 & i1;
+
+    if ( !(e0 == i0) || !(e1 == i1) ) {
+        YAS_TEST_REPORT(log, archive_type, test_name);
+        return false;
+    }
+
+    // the negative zero is not the default value
+    presence_event e2, i2;
+    e2.value = -0.0;
+    i2.value = 1.0;
+    typename archive_traits::oarchive oa1;
+    archive_traits::ocreate(oa1, archive_type);
+    oa1 & e2;
+
+    typename archive_traits::iarchive ia1;
+    archive_traits::icreate(ia1, oa1, archive_type);
+    ia1 & i2;
+
+    if ( std::memcmp(&e2.value, &i2.value, sizeof(double)) != 0 ) {
+        YAS_TEST_REPORT(log, archive_type, test_name);
+        return false;
+    }
+
+    // the default fields and the empty optionals take the bitmap only
+    if ( yas::is_binary_archive<typename archive_traits::oarchive_type>::value ) {
+        typename archive_traits::oarchive oa2;
+        archive_traits::ocreate(oa2, archive_type);
+        oa2 & e0;
+
+        typename archive_traits::oarchive oa3;
+        archive_traits::ocreate(oa3, archive_type);
+
+        if ( oa2.size() != oa3.size() + 1 ) {
+            YAS_TEST_REPORT(log, archive_type, test_name);
+            return false;
+        }
+    }
+
+    // the loaded absent fields are reset
+    std::uint32_t id = 7;
+    std::string source = "x";
+    typename archive_traits::oarchive oa4;
+    archive_traits::ocreate(oa4, archive_type);
+    oa4 & yas::presence(YAS_OBJECT_NVP("obj", ("id", id), ("source", source)));
+
+    id = 0;
+    source.clear();
+    typename archive_traits::iarchive ia4;
+    archive_traits::icreate(ia4, oa4, archive_type);
+    ia4 & yas::presence(YAS_OBJECT_NVP("obj", ("id", id), ("source", source)));
+
+    if ( id != 7 || source != "x" ) {
+        YAS_TEST_REPORT(log, archive_type, test_name);
+        return false;
+    }
+
+    return true;
+}
+
+/***************************************************************************/
+
+#endif // __yas__tests__base__include__wrap_presence_hpp
@@ -0,0 +1,136 @@
+
+// Copyright (c) 2010-2021 niXman (github dot nixman at pm dot me). All
+// rights reserved.
+//
+// This file is part of YAS(https://github.com/niXman/yas) project.
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//
+//
+// Boost Software License - Version 1.0 - August 17th, 2003
+//
+// Permission is hereby granted, free of charge, to any person or organization
+// obtaining a copy of the software and accompanying documentation covered by
+// this license (the "Software") to use, reproduce, display, distribute,
+// execute, and transmit the Software, and to prepare derivative works of the
+// Software, and to permit third-parties to whom the Software is furnished to
+// do so, all subject to the following:
+//
+// The copyright notices in the Software and this entire statement, including
+// the above license grant, this restriction and the following disclaimer,
+// must be included in all copies of the Software, in whole or in part, and
+// all derivative works of the Software, unless such copies or derivative
+// works are solely in the form of machine-executable object code generated by
+// a source language processor.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+// SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+// FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+
+
+#ifndef __yas__tests__base__include__wrap_quantize_hpp
+#define __yas__tests__base__include__wrap_quantize_hpp
+
+/***************************************************************************/
+
+template<typename archive_traits>
+bool wrap_quantize_test(std::ostream &log, const char *archive_type, const char *test_name) {
+    std::vector<float> v;
+    for ( std::size_t i = 0; i < 5000; ++i ) {
+        v.push_back(__YAS_SCAST(float, i % 97) * 0.125f - 6.f);
+    }
+    std::vector<double> dv = {0., 1.25, -1.5, 3.75, 1e12, -1e12};
+
+    typename archive_traits::oarchive oa;
+    archive_traits::ocreate(oa, archive_type);
+    oa & YAS_OBJECT_NVP("obj"
+        ,("h", yas::quantize<yas::f16>(v))
+        ,("b", yas::quantize<yas::bf16>(v))
+        ,("f", yas::fixed_point(v, 8.))
+        ,("d", yas::fixed_point(dv, 4.))
+    );
+
+    std::vector<float> h, b, f;
+    std::vector<double> d;
+    typename archive_traits::iarchive ia;
+    archive_traits::icreate(ia, oa, archive_type);
+    ia & YAS_OBJECT_NVP("obj"
+        ,("h", yas::quantize<yas::f16>(h))
+        ,("b", yas::quantize<yas::bf16>(b))
+        ,("f", yas::fixed_point(f, 8.))
+        ,("d", yas::fixed_point(d, 4.))
+    );
+
+    // the values are exactly representable in all the formats
+    if ( h != v || b != v || f != v ) {
+        YAS_TEST_REPORT(log, archive_type, test_name);
+        return false;
+    }
+
+    if ( yas::is_binary_archive<typename archive_traits::oarchive_type>::value ) {
+        // the out of range values are saturated
+        const std::vector<double> de = {0., 1.25, -1.5, 3.75, 2147483647. / 4., -2147483648. / 4.};
+        if ( d != de ) {
+            YAS_TEST_REPORT(log, archive_type, test_name);
+            return false;
+        }
+
+        typename archive_traits::oarchive oa2;
+        archive_traits::ocreate(oa2, archive_type);
+        oa2 & yas::quantize<yas::f16>(v);
+
+        typename archive_traits::oarchive oa3;
+        archive_traits::ocreate(oa3, archive_type);
+        oa3 & v;
+
+        if ( oa2.size() * 2 > oa3.size() + 16 ) {
+            YAS_TEST_REPORT(log, archive_type, test_name);
+            return false;
+        }
+    } else if ( d != dv ) {
+        YAS_TEST_REPORT(log, archive_type, test_name);
+        return false;
+    }
+
+    // the rounding to nearest-even, the overflow and the subnormals
+    if ( yas::detail::quantizer::to_f16(1.f + 1.f / 2048.f) != 0x3c00u
+        || yas::detail::quantizer::to_f16(1.f + 3.f / 2048.f) != 0x3c02u
+        || yas::detail::quantizer::to_f16(65520.f) != 0x7c00u
+        || yas::detail::quantizer::from_f16(0x0001u) != 5.9604644775390625e-8f
+        || yas::detail::quantizer::to_bf16(1.f + 1.f / 256.f) != 0x3f80u )
+    {
+        YAS_TEST_REPORT(log, archive_type, test_name);
+        return false;
+    }
+
+    // the scale should be positive and finite
+    const double bad_scales[] = {
+         0., -4., std::numeric_limits<double>::infinity(), std::numeric_limits<double>::quiet_NaN()
+    };
+    for ( const double scale: bad_scales ) {
+        bool thrown = false;
+        try {
+            typename archive_traits::oarchive oa4;
+            archive_traits::ocreate(oa4, archive_type);
+            oa4 & YAS_OBJECT_NVP("obj", ("d", yas::fixed_point(dv, scale)));
+        } catch (const yas::serialization_exception &) {
+            thrown = true;
+        }
+        if ( !thrown ) {
+            YAS_TEST_REPORT(log, archive_type, test_name);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/***************************************************************************/
+
+#endif // __yas__tests__base__include__wrap_quantize_hpp
@@ -0,0 +1,132 @@
+
+// Copyright (c) 2010-2021 niXman (github dot nixman at pm dot me). All
+// rights reserved.
+//
+// This file is part of YAS(https://github.com/niXman/yas) project.
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//
+//
+// Boost Software License - Version 1.0 - August 17th, 2003
+//
+// Permission is hereby granted, free of charge, to any person or organization
+// obtaining a copy of the software and accompanying documentation covered by
+// this license (the "Software") to use, reproduce, display, distribute,
+// execute, and transmit the Software, and to prepare derivative works of the
+// Software, and to permit third-parties to whom the Software is furnished to
+// do so, all subject to the following:
+//
+// The copyright notices in the Software and this entire statement, including
+// the above license grant, this restriction and the following disclaimer,
+// must be included in all copies of the Software, in whole or in part, and
+// all derivative works of the Software, unless such copies or derivative
+// works are solely in the form of machine-executable object code generated by
+// a source language processor.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+// SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+// FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+
+
+#ifndef __yas__tests__base__include__wrap_rle_hpp
+#define __yas__tests__base__include__wrap_rle_hpp
+
+/***************************************************************************/
+
+template<typename archive_traits>
+bool wrap_rle_test(std::ostream &log, const char *archive_type, const char *test_name) {
+    // the histogram with ~1% occupancy and the runs
+    std::vector<std::uint32_t> h(20000);
+    for ( std::size_t i = 0; i < h.size(); i += 97 ) {
+        h[i] = __YAS_SCAST(std::uint32_t, i * 3 + 1);
+    }
+    h.back() = 7;
+    std::vector<std::int16_t> r;
+    for ( std::int16_t i = 0; i < 100; ++i ) {
+        r.insert(r.end(), __YAS_SCAST(std::size_t, i % 7), __YAS_SCAST(std::int16_t, i - 50));
+    }
+    std::vector<double> d = {0., -0., 1., 1., 1., 1., 1., 2.5, 0., 0., 0., 0., 0., -3.};
+    std::vector<float> e;
+
+    typename archive_traits::oarchive oa;
+    archive_traits::ocreate(oa, archive_type);
+    oa & YAS_OBJECT_NVP("obj"
+        ,("hs", yas::sparse(h))
+        ,("hr", yas::rle(h))
+        ,("r", yas::rle(r))
+        ,("ds", yas::sparse(d))
+        ,("dr", yas::rle(d))
+        ,("es", yas::sparse(e))
+        ,("er", yas::rle(e))
+    );
+
+    std::vector<std::uint32_t> hs, hr;
+    std::vector<std::int16_t> ri;
+    std::vector<double> ds, dr;
+    std::vector<float> es, er;
+    typename archive_traits::iarchive ia;
+    archive_traits::icreate(ia, oa, archive_type);
+    ia & YAS_OBJECT_NVP("obj"
+        ,("hs", yas::sparse(hs))
+        ,("hr", yas::rle(hr))
+        ,("r", yas::rle(ri))
+        ,("ds", yas::sparse(ds))
+        ,("dr", yas::rle(dr))
+        ,("es", yas::sparse(es))
+        ,("er", yas::rle(er))
+    );
+
+    if ( hs != h || hr != h || ri != r || !es.empty() || !er.empty() ) {
+        YAS_TEST_REPORT(log, archive_type, test_name);
+        return false;
+    }
+    // bitwise, for the signed zeros
+    if ( ds.size() != d.size() || dr.size() != d.size()
+        || std::memcmp(ds.data(), d.data(), d.size() * sizeof(double)) != 0
+        || std::memcmp(dr.data(), d.data(), d.size() * sizeof(double)) != 0 )
+    {
+        YAS_TEST_REPORT(log, archive_type, test_name);
+        return false;
+    }
+
+    if ( yas::is_binary_archive<typename archive_traits::oarchive_type>::value ) {
+        typename archive_traits::oarchive oa2;
+        archive_traits::ocreate(oa2, archive_type);
+        oa2 & yas::sparse(h);
+
+        typename archive_traits::oarchive oa3;
+        archive_traits::ocreate(oa3, archive_type);
+        oa3 & yas::rle(h);
+
+        typename archive_traits::oarchive oa4;
+        archive_traits::ocreate(oa4, archive_type);
+        oa4 & h;
+
+        if ( oa2.size() * 10 > oa4.size() || oa3.size() * 5 > oa4.size() ) {
+            YAS_TEST_REPORT(log, archive_type, test_name);
+            return false;
+        }
+
+        // the loaded sparse container is cleared
+        std::vector<std::uint32_t> hs2(h.size() * 2, 1u);
+        typename archive_traits::iarchive ia2;
+        archive_traits::icreate(ia2, oa2, archive_type);
+        ia2 & yas::sparse(hs2);
+        if ( hs2 != h ) {
+            YAS_TEST_REPORT(log, archive_type, test_name);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/***************************************************************************/
+
+#endif // __yas__tests__base__include__wrap_rle_hpp
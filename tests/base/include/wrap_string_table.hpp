@@ -0,0 +1,145 @@
+
+// Copyright (c) 2010-2021 niXman (github dot nixman at pm dot me). All
+// rights reserved.
+//
+// This file is part of YAS(https://github.com/niXman/yas) project.
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//
+//
+// Boost Software License - Version 1.0 - August 17th, 2003
+//
+// Permission is hereby granted, free of charge, to any person or organization
+// obtaining a copy of the software and accompanying documentation covered by
+// this license (the "Software") to use, reproduce, display, distribute,
+// execute, and transmit the Software, and to prepare derivative works of the
+// Software, and to permit third-parties to whom the Software is furnished to
+// do so, all subject to the following:
+//
+// The copyright notices in the Software and this entire statement, including
+// the above license grant, this restriction and the following disclaimer,
+// must be included in all copies of the Software, in whole or in part, and
+// all derivative works of the Software, unless such copies or derivative
+// works are solely in the form of machine-executable object code generated by
+// a source language processor.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+// SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+// FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+
+
+#ifndef __yas__tests__base__include__wrap_string_table_hpp
+#define __yas__tests__base__include__wrap_string_table_hpp
+
+/***************************************************************************/
+
+template<typename archive_traits>
+bool string_table_overflow_test(std::ostream &, const char *, const char *, std::false_type) {
+    return true;
+}
+
+template<typename archive_traits>
+bool string_table_overflow_test(std::ostream &log, const char *archive_type, const char *test_name, std::true_type) {
+    typename archive_traits::oarchive oa;
+    archive_traits::ocreate(oa, archive_type);
+    const std::uint64_t lens[] = {~std::uint64_t(0), 2};
+    oa->write_seq_size(2);
+    oa->write_int_block(lens, 2);
+    oa->write("x", 1);
+
+    bool thrown = false;
+    try {
+        std::vector<std::string> vi;
+        typename archive_traits::iarchive ia;
+        archive_traits::icreate(ia, oa, archive_type);
+        ia & yas::string_table(vi);
+    } catch (const yas::io_exception &) {
+        thrown = true;
+    }
+    if ( !thrown ) {
+        YAS_TEST_REPORT(log, archive_type, test_name);
+        return false;
+    }
+
+    return true;
+}
+
+template<typename archive_traits>
+bool wrap_string_table_test(std::ostream &log, const char *archive_type, const char *test_name) {
+    std::vector<std::string> v;
+    for ( std::size_t i = 0; i < 3000; ++i ) {
+        v.push_back((i % 5) ? "sym-" + std::to_string(i) : std::string());
+    }
+    v.push_back(std::string(1000, 'x'));
+    std::map<std::string, std::uint32_t> m;
+    for ( std::uint32_t i = 0; i < 1500; ++i ) {
+        m.emplace("key-" + std::to_string(i), i);
+    }
+    std::list<std::string> l = {"a", "", "bc"};
+
+    typename archive_traits::oarchive oa;
+    archive_traits::ocreate(oa, archive_type);
+    oa & YAS_OBJECT_NVP("obj"
+        ,("v", yas::string_table(v))
+        ,("m", yas::string_table(m))
+        ,("l", yas::string_table(l))
+    );
+
+    std::vector<std::string> vi;
+    std::map<std::string, std::uint32_t> mi;
+    std::list<std::string> li;
+    typename archive_traits::iarchive ia;
+    archive_traits::icreate(ia, oa, archive_type);
+    ia & YAS_OBJECT_NVP("obj"
+        ,("v", yas::string_table(vi))
+        ,("m", yas::string_table(mi))
+        ,("l", yas::string_table(li))
+    );
+
+    if ( vi != v || mi != m || li != l ) {
+        YAS_TEST_REPORT(log, archive_type, test_name);
+        return false;
+    }
+
+    // the lengths of which the sum overflows are rejected
+    if ( !string_table_overflow_test<archive_traits>(log, archive_type, test_name, yas::is_binary_archive<typename archive_traits::oarchive_type>{}) ) {
+        return false;
+    }
+
+    if ( yas::is_binary_archive<typename archive_traits::oarchive_type>::value ) {
+        typename archive_traits::oarchive oa2;
+        archive_traits::ocreate(oa2, archive_type);
+        oa2 & yas::string_table(v);
+
+        typename archive_traits::oarchive oa3;
+        archive_traits::ocreate(oa3, archive_type);
+        oa3 & v;
+
+        if ( oa2.size() >= oa3.size() ) {
+            YAS_TEST_REPORT(log, archive_type, test_name);
+            return false;
+        }
+
+        // the loaded vector is resized, its strings are reused
+        std::vector<std::string> vi2(5, "old");
+        typename archive_traits::iarchive ia2;
+        archive_traits::icreate(ia2, oa2, archive_type);
+        ia2 & yas::string_table(vi2);
+        if ( vi2 != v ) {
+            YAS_TEST_REPORT(log, archive_type, test_name);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/***************************************************************************/
+
+#endif // __yas__tests__base__include__wrap_string_table_hpp
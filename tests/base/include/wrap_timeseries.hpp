@@ -0,0 +1,95 @@
+
+// Copyright (c) 2010-2021 niXman (github dot nixman at pm dot me). All
+// rights reserved.
+//
+// This file is part of YAS(https://github.com/niXman/yas) project.
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//
+//
+// Boost Software License - Version 1.0 - August 17th, 2003
+//
+// Permission is hereby granted, free of charge, to any person or organization
+// obtaining a copy of the software and accompanying documentation covered by
+// this license (the "Software") to use, reproduce, display, distribute,
+// execute, and transmit the Software, and to prepare derivative works of the
+// Software, and to permit third-parties to whom the Software is furnished to
+// do so, all subject to the following:
+//
+// The copyright notices in the Software and this entire statement, including
+// the above license grant, this restriction and the following disclaimer,
+// must be included in all copies of the Software, in whole or in part, and
+// all derivative works of the Software, unless such copies or derivative
+// works are solely in the form of machine-executable object code generated by
+// a source language processor.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+// SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+// FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+
+
+#ifndef __yas__tests__base__include__wrap_timeseries_hpp
+#define __yas__tests__base__include__wrap_timeseries_hpp
+
+/***************************************************************************/
+
+template<typename archive_traits>
+bool wrap_timeseries_test(std::ostream &log, const char *archive_type, const char *test_name) {
+    using time_point = std::chrono::time_point<std::chrono::system_clock, std::chrono::milliseconds>;
+    std::vector<time_point> ts, tsi;
+    std::vector<double> vd, vdi;
+    std::vector<float> vf, vfi;
+    for ( int i = 0; i < 1000; ++i ) {
+        ts.emplace_back(std::chrono::milliseconds(1500000000000ll + i * 1000 + (i % 3)));
+        vd.push_back(20.5 + (i / 10) * 0.25 - (i % 7 == 0 ? 1000 : 0));
+        vf.push_back(static_cast<float>(i % 40) / 8);
+    }
+
+    typename archive_traits::oarchive oa;
+    archive_traits::ocreate(oa, archive_type);
+    oa & YAS_OBJECT_NVP("obj"
+        ,("ts", yas::timeseries(ts))
+        ,("vd", yas::timeseries(vd))
+        ,("vf", yas::timeseries(vf))
+    );
+
+    typename archive_traits::oarchive oa2;
+    archive_traits::ocreate(oa2, archive_type);
+    oa2 & YAS_OBJECT_NVP("obj", ("ts", ts), ("vd", vd), ("vf", vf));
+
+    // the series are encoded in binary archives only
+    if ( yas::is_binary_archive<typename archive_traits::oarchive_type>::value ) {
+        if ( oa.size() * 4 > oa2.size() ) {
+            YAS_TEST_REPORT(log, archive_type, test_name);
+            return false;
+        }
+    } else if ( oa.size() != oa2.size() ) {
+        YAS_TEST_REPORT(log, archive_type, test_name);
+        return false;
+    }
+
+    typename archive_traits::iarchive ia;
+    archive_traits::icreate(ia, oa, archive_type);
+    ia & YAS_OBJECT_NVP("obj"
+        ,("ts", yas::timeseries(tsi))
+        ,("vd", yas::timeseries(vdi))
+        ,("vf", yas::timeseries(vfi))
+    );
+
+    if ( ts != tsi || vd != vdi || vf != vfi ) {
+        YAS_TEST_REPORT(log, archive_type, test_name);
+        return false;
+    }
+
+    return true;
+}
+
+/***************************************************************************/
+
+#endif // __yas__tests__base__include__wrap_timeseries_hpp
@@ -58,7 +58,16 @@ bool wstring_test(std::ostream &log, const char *archive_type, const char *test_
 		L"Мога да ям стъкло, то не ми вреди.", // bg
 		L"Cam yiyebilirim, bana zararı dokunmaz.", // tr
 		L"Je peux manger du verre, ça ne me fait pas de mal.", // fr
+		L"\U0001F600 smile \U0001F680 rocket \U00010348", // outside of the BMP
 	};
+	// ASCII runs with multi-byte chars at the ends of the SIMD blocks
+	std::wstring mixed;
+	for ( std::size_t i = 0; i < 300; ++i ) {
+		mixed += (i % 37 == 0) ? L'\x44F' : (i % 31 == 0) ? L'\x20AC' : wchar_t(L'a' + i % 26);
+		if ( i % 43 == 0 ) mixed += L"\U0001F600";
+	}
+	wcs_collection.push_back(mixed);
+	wcs_collection.push_back(std::wstring(1000, L'x'));
 
 	for (auto& ws : wcs_collection) {
 		std::wstring wss;
@@ -77,6 +86,29 @@ bool wstring_test(std::ostream &log, const char *archive_type, const char *test_
 		}
 	}
 
+	// the truncated, overlong and out of range sequences are rejected
+	const char *invalid[] = {"abc\xE2\x82", "\xC0\x80", "\xF4\x90\x80\x80", "\x80"};
+	for (const char *str : invalid) {
+		std::string s(str);
+		typename archive_traits::oarchive oa;
+		archive_traits::ocreate(oa, archive_type);
+		oa& YAS_OBJECT_NVP("obj", ("ws", s));
+
+		std::wstring wss;
+		typename archive_traits::iarchive ia;
+		archive_traits::icreate(ia, oa, archive_type);
+		bool thrown = false;
+		try {
+			ia& YAS_OBJECT_NVP("obj", ("ws", wss));
+		} catch (const yas::serialization_exception &) {
+			thrown = true;
+		}
+		if (!thrown) {
+			YAS_TEST_REPORT(log, archive_type, test_name);
+			return false;
+		}
+	}
+
 	return true;
 }
 
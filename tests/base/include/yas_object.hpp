@@ -493,6 +493,67 @@ bool yas_object_test(std::ostream &log, const char *archive_type, const char *te
             }
         }
     }
+    {
+        if ( archive_traits::iarchive_type::flags() & yas::json ) {
+            if ( !(archive_traits::iarchive_type::flags() & yas::compacted)) {
+                // the unknown values are skipped by the structural index on the
+                // contiguous input and char by char on the std::istream
+                std::string json = "{\"x\":{\"s\":\"a\\\"}]\\\\\",\"v\":[1,[2,{\"q\":\"{[\"}],-3],\"e\":{}}"
+                    ",\"b\":1,\"y\":[\"";
+                json += std::string(200, '\\');
+                json += "\",\"]\"],\"z\":\"";
+                for ( int i = 0; i < 100; ++i ) {
+                    json += "\\\"{";
+                }
+                json += "\",\"a\":-7,\"w\":true}";
+
+                int a = 0, b = 0;
+                yas::mem_istream mis(json.data(), json.size());
+                yas::json_iarchive<yas::mem_istream> mia(mis);
+                mia & YAS_OBJECT(nullptr, a, b);
+                if ( a != -7 || b != 1 ) {
+                    YAS_TEST_REPORT(log, archive_type, test_name);
+                    return false;
+                }
+
+                a = b = 0;
+                std::istringstream ss(json);
+                yas::std_istream_adapter sis(ss);
+                yas::json_iarchive<yas::std_istream_adapter> sia(sis);
+                sia & YAS_OBJECT(nullptr, a, b);
+                if ( a != -7 || b != 1 ) {
+                    YAS_TEST_REPORT(log, archive_type, test_name);
+                    return false;
+                }
+            }
+        }
+    }
+    {
+        if ( archive_traits::iarchive_type::flags() & yas::json ) {
+            if ( !(archive_traits::iarchive_type::flags() & yas::compacted)) {
+                // the keys out of the declared order are found by the hash
+                static const char json[] = "{\"f\":6,\"c\":3,\"unknown\":0,\"a\":1,\"e\":5,\"b\":2,\"d\":4}";
+                int a = 0, b = 0, c = 0, d = 0, e = 0, f = 0;
+                yas::mem_istream mis(json, sizeof(json)-1);
+                yas::json_iarchive<yas::mem_istream> mia(mis);
+                mia & YAS_OBJECT(nullptr, a, b, c, d, e, f);
+                if ( a != 1 || b != 2 || c != 3 || d != 4 || e != 5 || f != 6 ) {
+                    YAS_TEST_REPORT(log, archive_type, test_name);
+                    return false;
+                }
+
+                a = b = c = d = e = f = 0;
+                std::istringstream ss(std::string(json, sizeof(json)-1));
+                yas::std_istream_adapter sis(ss);
+                yas::json_iarchive<yas::std_istream_adapter> sia(sis);
+                sia & YAS_OBJECT(nullptr, a, b, c, d, e, f);
+                if ( a != 1 || b != 2 || c != 3 || d != 4 || e != 5 || f != 6 ) {
+                    YAS_TEST_REPORT(log, archive_type, test_name);
+                    return false;
+                }
+            }
+        }
+    }
 
 #if 0
     {
@@ -0,0 +1,130 @@
+
+// Copyright (c) 2010-2021 niXman (github dot nixman at pm dot me). All
+// rights reserved.
+//
+// This file is part of YAS(https://github.com/niXman/yas) project.
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//
+//
+// Boost Software License - Version 1.0 - August 17th, 2003
+//
+// Permission is hereby granted, free of charge, to any person or organization
+// obtaining a copy of the software and accompanying documentation covered by
+// this license (the "Software") to use, reproduce, display, distribute,
+// execute, and transmit the Software, and to prepare derivative works of the
+// Software, and to permit third-parties to whom the Software is furnished to
+// do so, all subject to the following:
+//
+// The copyright notices in the Software and this entire statement, including
+// the above license grant, this restriction and the following disclaimer,
+// must be included in all copies of the Software, in whole or in part, and
+// all derivative works of the Software, unless such copies or derivative
+// works are solely in the form of machine-executable object code generated by
+// a source language processor.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+// SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+// FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+
+
+#ifndef __yas__tests__base__include__yas_trivial_hpp
+#define __yas__tests__base__include__yas_trivial_hpp
+
+#include <yas/object.hpp>
+#include "../test.hpp"
+
+/***************************************************************************/
+
+namespace _yas_trivial_test {
+
+template<int>
+struct point {
+    float x;
+    float y;
+    float z;
+
+    bool operator== (const point &r) const { return x == r.x && y == r.y && z == r.z; }
+
+    YAS_DEFINE_STRUCT_SERIALIZE("point", x, y, z);
+};
+
+using trivial_point = point<0>;
+using plain_point = point<1>;
+
+struct pixel {
+    std::uint8_t r;
+    std::uint8_t g;
+    std::uint8_t b;
+    std::uint8_t a;
+    std::uint32_t id;
+
+    bool operator== (const pixel &o) const { return r == o.r && g == o.g && b == o.b && a == o.a && id == o.id; }
+
+    YAS_DEFINE_STRUCT_SERIALIZE("pixel", r, g, b, a, id);
+};
+
+} // ns _yas_trivial_test
+
+YAS_TRIVIAL(_yas_trivial_test::trivial_point, x, y, z)
+YAS_TRIVIAL(_yas_trivial_test::pixel, r, g, b, a, id)
+
+/***************************************************************************/
+
+template<typename archive_traits>
+bool yas_trivial_test(std::ostream &log, const char *archive_type, const char *test_name) {
+    using namespace _yas_trivial_test;
+
+    std::vector<trivial_point> v, vi;
+    std::vector<plain_point> pv;
+    for ( int i = 0; i < 1000; ++i ) {
+        v.push_back({i / 2.f, -i / 4.f, i * 8.f});
+        pv.push_back({i / 2.f, -i / 4.f, i * 8.f});
+    }
+    std::deque<pixel> d, di;
+    for ( std::uint32_t i = 0; i < 3000; ++i ) {
+        d.push_back({__YAS_SCAST(std::uint8_t, i), 1, 2, 3, i * 7});
+    }
+    std::array<pixel, 7> a{}, ai{};
+    a[3].id = 33;
+
+    typename archive_traits::oarchive oa;
+    archive_traits::ocreate(oa, archive_type);
+    oa & YAS_OBJECT_NVP("obj", ("v", v), ("d", d), ("a", a));
+
+    typename archive_traits::iarchive ia;
+    archive_traits::icreate(ia, oa, archive_type);
+    ia & YAS_OBJECT_NVP("obj", ("v", vi), ("d", di), ("a", ai));
+
+    if ( v != vi || d != di || a != ai ) {
+        YAS_TEST_REPORT(log, archive_type, test_name);
+        return false;
+    }
+
+    // the spans are stored with the same bytes as serialize() produces
+    typename archive_traits::oarchive oa2;
+    archive_traits::ocreate(oa2, archive_type);
+    oa2 & v;
+
+    typename archive_traits::oarchive oa3;
+    archive_traits::ocreate(oa3, archive_type);
+    oa3 & pv;
+
+    const yas::intrusive_buffer buf = oa3.get_intrusive_buffer();
+    if ( !oa2.compare(buf.data, buf.size) ) {
+        YAS_TEST_REPORT(log, archive_type, test_name);
+        return false;
+    }
+
+    return true;
+}
+
+/***************************************************************************/
+
+#endif // __yas__tests__base__include__yas_trivial_hpp
@@ -100,6 +100,9 @@
 #include "include/deque.hpp"
 #include "include/std_streams.hpp"
 #include "include/serialize.hpp"
+#include "include/serialized_size.hpp"
+#include "include/interned.hpp"
+#include "include/raw_wide.hpp"
 #include "include/set.hpp"
 #include "include/string.hpp"
 #include "include/string_view.hpp"
@@ -118,9 +121,18 @@
 #include "include/split_memfn.hpp"
 #include "include/serialization.hpp"
 #include "include/yas_object.hpp"
+#include "include/yas_trivial.hpp"
 #include "include/json_conformance.hpp"
 #include "include/wrap_asis.hpp"
 #include "include/wrap_init.hpp"
+#include "include/wrap_delta.hpp"
+#include "include/wrap_timeseries.hpp"
+#include "include/wrap_columnar.hpp"
+#include "include/wrap_presence.hpp"
+#include "include/wrap_narrow.hpp"
+#include "include/wrap_quantize.hpp"
+#include "include/wrap_rle.hpp"
+#include "include/wrap_string_table.hpp"
 
 #if defined(YAS_SERIALIZE_BOOST_TYPES)
 #include "include/boost_fusion_list.hpp"
@@ -360,7 +372,11 @@ void tests(std::ostream &log, int &p, int &e) {
     YAS_RUN_TEST(log, split_methods, p, e);
     YAS_RUN_TEST(log, serialize, p, e);
     YAS_RUN_TEST(log, serialization, p, e);
+    YAS_RUN_TEST(log, serialized_size, p, e, yas::text|yas::json);
+    YAS_RUN_TEST(log, interned, p, e, yas::text|yas::json);
+    YAS_RUN_TEST(log, raw_wide, p, e, yas::text|yas::json);
     YAS_RUN_TEST(log, yas_object, p, e);
+    YAS_RUN_TEST(log, yas_trivial, p, e);
     YAS_RUN_TEST(log, base_object, p, e);
     YAS_RUN_TEST(log, archive_type, p, e);
     YAS_RUN_TEST(log, array, p, e);
@@ -390,6 +406,14 @@ void tests(std::ostream &log, int &p, int &e) {
     YAS_RUN_TEST(log, variant, p, e);
     YAS_RUN_TEST(log, wrap_asis, p, e);
     YAS_RUN_TEST(log, wrap_init, p, e);
+    YAS_RUN_TEST(log, wrap_delta, p, e);
+    YAS_RUN_TEST(log, wrap_timeseries, p, e);
+    YAS_RUN_TEST(log, wrap_columnar, p, e);
+    YAS_RUN_TEST(log, wrap_presence, p, e);
+    YAS_RUN_TEST(log, wrap_narrow, p, e);
+    YAS_RUN_TEST(log, wrap_quantize, p, e);
+    YAS_RUN_TEST(log, wrap_rle, p, e);
+    YAS_RUN_TEST(log, wrap_string_table, p, e);
 #if defined(YAS_SERIALIZE_BOOST_TYPES)
     YAS_RUN_TEST(log, boost_fusion_pair, p, e);
     YAS_RUN_TEST(log, boost_fusion_tuple, p, e);
@@ -92,6 +92,7 @@ HEADERS += \
     ../../include/yas/boost_types.hpp \
     ../../include/yas/buffers.hpp \
     ../../include/yas/defaul_traits.hpp \
+    ../../include/yas/fast_traits.hpp \
     ../../include/yas/file_streams.hpp \
     ../../include/yas/json_iarchive.hpp \
     ../../include/yas/json_oarchive.hpp \
@@ -298,6 +298,7 @@ HEADERS += \
 	../../include/yas/detail/io/json_streams.hpp \
 	../../include/yas/detail/io/text_streams.hpp \
 	../../include/yas/defaul_traits.hpp \
+	../../include/yas/fast_traits.hpp \
 	../../include/yas/std_traits.hpp \
 	../../include/yas/serializers/binary/boost/boost_container_deque_serializers.hpp \
 	../../include/yas/serializers/binary/boost/boost_container_flat_map_serializers.hpp \
@@ -100,15 +100,10 @@ struct struct_of_fundamentals {
 			& g;
 	}
 
+	/** the variadic form lets yas write the members by one call */
 	template<typename Archive>
 	void serialize(Archive& ar) {
-		ar & a
-			& b
-			& c
-			& d
-			& e
-			& f
-			& g;
+		ar(a, b, c, d, e, f, g);
 	}
 };
 
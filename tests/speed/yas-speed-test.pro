@@ -27,6 +27,7 @@ HEADERS += \
     ../../include/yas/boost_types.hpp \
     ../../include/yas/buffers.hpp \
     ../../include/yas/defaul_traits.hpp \
+    ../../include/yas/fast_traits.hpp \
     ../../include/yas/file_streams.hpp \
     ../../include/yas/mem_streams.hpp \
     ../../include/yas/std_traits.hpp \